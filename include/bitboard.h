@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <array>
 #include <cassert>
 
 #include "constants.h"
@@ -107,4 +108,56 @@ constexpr u64 FILE_BB[8] = {
 	0x4040404040404040,    // G file
 	0x8080808080808080,    // H file
 };
+
+// walks from one square towards another, returning the squares strictly between them if
+// they share a rank, file or diagonal, or the whole line through them if line is set
+constexpr u64 squares_aligned(int a, int b, bool line)
+{
+	int dr = b / 8 - a / 8;
+	int df = b % 8 - a % 8;
+
+	if (a == b || (dr != 0 && df != 0 && dr != df && dr != -df))
+		return 0;
+
+	int step_r = (dr > 0) - (dr < 0);
+	int step_f = (df > 0) - (df < 0);
+
+	auto on_board = [](int r, int f) { return r >= 0 && r < 8 && f >= 0 && f < 8; };
+
+	u64 bb = 0;
+	if (line)
+	{
+		// back up to the edge of the board, then walk across to the other edge
+		int r = a / 8, f = a % 8;
+		while (on_board(r - step_r, f - step_f))
+			r -= step_r, f -= step_f;
+
+		for (; on_board(r, f); r += step_r, f += step_f)
+			bb |= 1ull << (r * 8 + f);
+	}
+
+	else
+	{
+		for (int r = a / 8 + step_r, f = a % 8 + step_f; r * 8 + f != b; r += step_r, f += step_f)
+			bb |= 1ull << (r * 8 + f);
+	}
+
+	return bb;
+}
+
+constexpr std::array<std::array<u64, 64>, 64> make_aligned_table(bool line)
+{
+	std::array<std::array<u64, 64>, 64> table {};
+	for (int a = 0; a < 64; a++)
+		for (int b = 0; b < 64; b++)
+			table[a][b] = squares_aligned(a, b, line);
+
+	return table;
+}
+
+// BETWEEN_BB[a][b] is the squares strictly between a and b, or 0 if they are not on a common line
+inline constexpr auto BETWEEN_BB = make_aligned_table(false);
+
+// LINE_BB[a][b] is the entire rank, file or diagonal through a and b, or 0 if they are not on a common line
+inline constexpr auto LINE_BB = make_aligned_table(true);
 }
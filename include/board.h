@@ -16,68 +16,169 @@
 #pragma once
 
 #include <iostream>
-#include <stack>
 #include <string>
 
 #include "bitboard.h"
 #include "move.h"
 #include "types.h"
 
-// irreversable aspects of a position, like enpassant state, castling rights, and halfmove clock
-struct BoardState
+// number of positions the board remembers (game history plus search). a longer game forgets its
+// oldest positions, so only the last MAX_HISTORY / 2 moves can always be undone, see Board::save
+constexpr int MAX_HISTORY = 1024;
+
+// most moves a search may make from its root, it must be able to undo every one of them
+constexpr int MAX_PLY = MAX_HISTORY / 2;
+
+/*
+ * how a move is undone, chosen at compile time (make COPY_MAKE=1 for copy-make)
+ * make/unmake: there is one placement of the pieces, updated in place by make_move and undo_move
+ * copy-make:   there is a placement per ply, make_move copies the current one into the next ply
+ *              and updates the copy, undo_move just steps back a ply
+ */
+#ifdef COPY_MAKE
+constexpr bool COPY_MAKE_BOARD = true;
+#else
+constexpr bool COPY_MAKE_BOARD = false;
+#endif
+
+// a mailbox entry holds the type of the piece on a square in bits 0-2 and its color in bit 3
+constexpr u8 mailbox_entry(PieceType pt, Color c) { return pt | c << 3; }
+
+/*
+ * where the pieces are, the part of a position that copy-make copies. the bitboards fill the
+ * first cache line and the mailbox the second, the type of an empty square is NONE
+ */
+struct alignas(64) Placement
 {
-	BoardState() = delete;
-	BoardState(bool saved_castle_rights[2][2], Square ep_sq)
-	{
-		castle_rights[0][0] = saved_castle_rights[0][0];
-		castle_rights[0][1] = saved_castle_rights[0][1];
-		castle_rights[1][0] = saved_castle_rights[1][0];
-		castle_rights[1][1] = saved_castle_rights[1][1];
+	u64 piece_bb[6];
+	u64 color_bb[2];
+	u8 board[64];
+};
 
-		ep_sq = ep_sq;
-	}
+/*
+ * facts about a position that move generation, check detection and evaluation all need, from the
+ * point of view of the side to move. they are computed the first time they are needed in a position
+ * and cached on the state stack, so undoing a move gets the parent's back for free.
+ */
+struct PositionInfo
+{
+	u64 checkers;            // opponent pieces giving check
+	u64 pinned;              // our pieces pinned to our king
+	u64 opponent_attacks;    // squares the opponent attacks, seeing through our king
+	u64 check_squares[6];    // squares each of our piece types would give check from
+	u64 discoverers;         // our pieces that give discovered check by moving off the line to their king
+};
+
+// a middlegame and an endgame score, blended by the game phase when a position is evaluated
+struct Score
+{
+	float mg;
+	float eg;
+
+	constexpr Score &operator+=(Score s) { mg += s.mg; eg += s.eg; return *this; }
+	constexpr Score &operator-=(Score s) { mg -= s.mg; eg -= s.eg; return *this; }
+};
+
+// game phase with the starting material on the board, promotions can take the phase past it
+constexpr int MAX_PHASE = 24;
+
+// bit of BoardState::castle_rights that is set while a castle is still allowed
+constexpr u8 castle_bit(Color c, CastleTypes ct) { return 1 << (2 * c + ct); }
+
+// irreversable aspects of a position, like enpassant state and castling rights,
+// along with the type of piece captured by the move that reached the position (used for undo move)
+struct BoardState
+{
+	u64 key;               // polyglot zobrist key of the position
+	u8 castle_rights;      // castle_bit of every castle still allowed
+	u8 ep_sq;              // enpassant square, EP_NONE if there is none
+	u8 captured;           // type of the captured piece, NONE if the last move was not a capture
+	u8 phase;              // game phase, the sum of the phase weights of the pieces on the board
+	Score psq;             // material and piece-square score, from white's point of view
+
+	// cache of information derived from the position, see Board::info() and Board::in_check()
+	mutable bool info_valid;
+	mutable bool checkers_valid;    // info.checkers can be known without the rest of info
+	mutable PositionInfo info;
+};
 
-	bool castle_rights[2][2];
-	Square ep_sq;
+// moves whose flags are made and undone the same way, see Board::make_move
+enum class MoveClass
+{
+	QUIET,
+	CAPTURE,
+	DOUBLE_PUSH,
+	ENPASSANT,
+	CASTLE,
+	PROMOTION,
 };
 
+/*
+ * Board deliberately has no constructor so that the global thread_local board (see main.cpp)
+ * needs no dynamic initialization; call reset() or clear() before use
+ */
 class Board
 {
 public:
-	Board();
-
+	void reset();
 	void clear();
 	void set_piece(PieceType, Square, Color);
 	void set_to_move(Color);
-	bool in_check(Color);
+	bool in_check(Color) const;
+	bool is_pseudo_legal(Move) const;
+	bool is_legal(Move) const;
+	bool gives_check(Move) const;
+	bool see(Move, float) const;
 
 	// get all pieces on the board
-	inline u64 pieces()                      const { return color_bb[WHITE] | color_bb[BLACK]; }
+	inline u64 pieces()                      const { return pos().color_bb[WHITE] | pos().color_bb[BLACK]; }
 	// get all pieces of a certain color
-	inline u64 pieces(Color c)               const { return color_bb[c]; }
+	inline u64 pieces(Color c)               const { return pos().color_bb[c]; }
 	// get all pieces of a certain type
-	inline u64 pieces(PieceType pt)          const { return piece_bb[pt]; }
+	inline u64 pieces(PieceType pt)          const { return pos().piece_bb[pt]; }
 	// get all pieces of a certain color and type
-	inline u64 pieces(PieceType pt, Color c) const { return piece_bb[pt] & color_bb[c]; }
+	inline u64 pieces(PieceType pt, Color c) const { return pos().piece_bb[pt] & pos().color_bb[c]; }
 
-	inline bool get_castle_rights(Color c, CastleTypes ct) const { return castle_rights[c][ct]; }
-	inline void set_castle_rights(Color c, CastleTypes ct) { castle_rights[c][ct] = true; }
+	inline bool get_castle_rights(Color c, CastleTypes ct) const { return state().castle_rights & castle_bit(c, ct); }
+	void set_castle_rights(Color, CastleTypes);
 
-	inline Square get_ep_sq() const { return ep_sq; }
-	inline void set_ep_sq(Square sq) { ep_sq = sq; }
+	inline Square get_ep_sq() const { return static_cast<Square>(state().ep_sq); }
+	void set_ep_sq(Square);
+
+	// zobrist key of the position, kept up to date incrementally (see zobrist.h)
+	inline u64 key() const { return state().key; }
+
+	// material and piece-square score and game phase, kept up to date incrementally like the key
+	inline Score psq() const { return state().psq; }
+	inline int phase() const { return state().phase; }
 
 	inline Square king_square(Color c) const
 	{
-		u64 king = piece_bb[KING] & color_bb[c];
+		u64 king = pos().piece_bb[KING] & pos().color_bb[c];
 		return bitscan(king);
 	}
 
+	// checkers, pins and attacks of the position, computed on first use
+	inline PositionInfo const &info() const
+	{
+		if (!state().info_valid)
+			compute_info();
+
+		return state().info;
+	}
+
 	inline Color mover() const { return to_move; }
-	inline PieceType piece_on(Square square) const { return board[square]; }
+	inline PieceType piece_on(Square square) const { return static_cast<PieceType>(pos().board[square] & 0x7); }
+	// color of the piece on a square, meaningless if the square is empty
+	inline Color color_on(Square square)     const { return static_cast<Color>(pos().board[square] >> 3); }
 
 	void make_move(Move const &);
 	void undo_move(Move const &);
 
+	// make_move and undo_move as one function for every kind of move, kept to benchmark against
+	void make_move_generic(Move const &);
+	void undo_move_generic(Move const &);
+
 	std::string to_string() const;
 	friend std::ostream &operator<<(std::ostream &os, Board const &b)
 	{
@@ -87,19 +188,41 @@ public:
 
 private:
 
-	u64 piece_bb[6];
-	u64 color_bb[2];
-	bool castle_rights[2][2];
-	Square ep_sq;    // enpassant square
-	std::stack<BoardState> saved_state;
-	PieceType board[64];
+	Color to_move;
 
-	// type of the most recently captured pieces (used for undo move)
-	std::stack<PieceType> capture_stack;
+#ifdef COPY_MAKE
+	// placements[game_ply] is where the pieces are now, making a move copies it into the next entry
+	Placement placements[MAX_HISTORY];
 
-	Color to_move;
+	inline Placement &pos() { return placements[game_ply]; }
+	inline Placement const &pos() const { return placements[game_ply]; }
+#else
+	Placement placement;
+
+	inline Placement &pos() { return placement; }
+	inline Placement const &pos() const { return placement; }
+#endif
+
+	/*
+	 * preallocated undo history: history[game_ply] is the state of the current position,
+	 * making a move copies it into the next entry and undoing a move just steps back one entry.
+	 * this keeps make_move and undo_move free of memory allocation
+	 */
+	BoardState history[MAX_HISTORY];
+	int game_ply;
+
+	inline BoardState &state() { return history[game_ply]; }
+	inline BoardState const &state() const { return history[game_ply]; }
 
-	void reset();
 	void save();
 	void restore();
+	void forget_history();
+	template<Color> void make_move(Move);
+	template<Color> void undo_move(Move);
+	template<Color, MoveClass> void make(Move);
+	template<Color, MoveClass> void unmake(Move);
+	void compute_info() const;
+	inline void invalidate_info() { state().info_valid = state().checkers_valid = false; }
+	void clear_castle_rights(Color, CastleTypes);
+	void update_castle_rights(Square, Square);
 };
@@ -875,4233 +875,4 @@ namespace Constants
             0x0000000000000000,
         },
     };
-
-    // direction lookup table from one square to another
-    // example: Direction dir = dir_lookup_table[from_sq][to_sq]
-    constexpr Direction dir_lookup_table[64][64] = {
-        {
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-        },
-        {
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-        },
-        {
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-        },
-        {
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-        },
-        {
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-        },
-        {
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-        },
-        {
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-        },
-        {
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-            NORTHEAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTHWEST,
-            NORTH,
-        },
-        {
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-            EAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-            EAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-            EAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHEAST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-            EAST,
-        },
-        {
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTHWEST,
-            SOUTH,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            WEST,
-            NORTH,
-        },
-    };
 };
@@ -14,8 +14,8 @@
 
 // global board object
 class Board;
-extern Board board;
+extern thread_local Board board;
 
-void parse_uci_moves(std::string const &);
-void parse_uci_move(std::string const &);
-void load_fen(std::string const &);
+bool parse_uci_moves(std::string const &);
+bool parse_uci_move(std::string const &);
+bool load_fen(std::string const &);
@@ -0,0 +1,90 @@
+/** excalibur
+ * License: GPLv2
+ * See LICENSE for full license text
+ * Author: Sam Kravitz
+ * 
+ * FILE: magic.h
+ * DATE: October 17th, 2026
+ * DESCRIPTION: magic bitboard lookup of sliding piece attacks
+ * 
+ * For every square, a slider's attacks only depend on the pieces in its relevant occupancy mask
+ * (the squares along its rays, excluding the board edge). Multiplying the masked occupancy by a
+ * "magic" number maps each of those blocker subsets to a unique index into a table of precomputed
+ * attack sets, so a sliding attack becomes a mask, a multiply, a shift, and a load.
+ * The tables of all 64 squares are packed into one shared array for each piece type (fancy magics).
+ * 
+ * On CPUs with a fast BMI2 PEXT instruction, the index is instead the masked occupancy bits
+ * extracted into a dense integer, which needs no magic multiplier. The backend is chosen once
+ * at startup from CPUID so the same binary runs on any x86-64 CPU.
+ * 
+ * https://www.chessprogramming.org/Magic_Bitboards
+ * https://www.chessprogramming.org/BMI2#PEXTBitboards
+ */
+
+#pragma once
+
+#include "types.h"
+
+namespace Magic
+{
+enum Backend
+{
+	MAGIC,
+	PEXT,
+};
+
+// backend selected by init()
+extern Backend backend;
+
+/*
+ * parallel bit extract of src under mask.
+ * written as inline asm rather than _pext_u64 so that it can be inlined into code
+ * that is not compiled with -mbmi2; it is only ever executed when backend == PEXT
+ */
+inline u64 pext(u64 src, u64 mask)
+{
+#if defined(__x86_64__)
+	u64 res;
+	asm("pextq %2, %1, %0" : "=r"(res) : "r"(src), "r"(mask));
+	return res;
+#else
+	(void) src;
+	(void) mask;
+	return 0;
+#endif
+}
+
+struct Entry
+{
+	u64 mask;        // relevant occupancy mask
+	u64 magic;       // magic multiplier
+	u64 *attacks;    // pointer to this square's slice of the shared attack table
+	unsigned shift;  // 64 - number of bits in mask
+
+	inline unsigned index(u64 occupied) const
+	{
+		if (backend == PEXT)
+			return pext(occupied, mask);
+
+		return ((occupied & mask) * magic) >> shift;
+	}
+};
+
+extern Entry bishop_magics[64];
+extern Entry rook_magics[64];
+
+void init();
+const char *backend_name();
+
+inline u64 bishop_attacks(Square square, u64 occupied)
+{
+	Entry const &e = bishop_magics[square];
+	return e.attacks[e.index(occupied)];
+}
+
+inline u64 rook_attacks(Square square, u64 occupied)
+{
+	Entry const &e = rook_magics[square];
+	return e.attacks[e.index(occupied)];
+}
+}
@@ -25,7 +25,10 @@
 
 // global board object
 class Board;
-extern Board board;
+extern thread_local Board board;
+
+// piece a promotion flag promotes to, indexed by the low two bits of the flag
+constexpr PieceType PROMOTION_PIECE[4] = { KNIGHT, BISHOP, ROOK, QUEEN };
 
 struct Move
 {
@@ -35,7 +38,7 @@ public:
 		move_enc = ((flags & 0xf) << 12) | ((from & 0x3f) << 6) | (to & 0x3f);
 	}
 
-	Move() { move_enc = 0; }
+	constexpr Move() : move_enc(0) { }
 	Move(int enc) : move_enc(enc) { }
 
 	Move(int from, int to) : Move(static_cast<Square>(from), static_cast<Square>(to)) { }
@@ -51,6 +54,8 @@ public:
 	// a1a1, a nonsense move
 	inline bool is_empty()     const { return move_enc == 0; }
 
+	inline bool operator==(Move const &other) const { return move_enc == other.move_enc; }
+
 	friend std::ostream &operator<<(std::ostream &os, const Move &mv)
 	{
 		std::string promo = "";
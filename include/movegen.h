@@ -18,14 +18,36 @@
 enum MovegenType
 {
 	ALL,
-	CAPTURES,
+	CAPTURES,        // captures, including enpassant and capture promotions
+	QUIETS,          // everything else, including castling and non-capture promotions
+	EVASIONS,        // every move out of check, only valid when the side to move is in check
+	QUIET_CHECKS,    // quiet moves that give check, except castling, only valid when not in check
 };
 
-Movelist generate_moves();
-Movelist generate_captures();
+/*
+ * legal generation leaves out every move that would leave our king in check. pseudo-legal generation
+ * skips the work of finding the opponent's attacks, checks and pins, and may include such moves.
+ * each pseudo-legal move must then be tested with Board::is_legal before it is made, which is
+ * cheaper whenever only a few of the moves are ever tried, as at most nodes of a search
+ */
+enum Legality
+{
+	LEGAL,
+	PSEUDO_LEGAL,
+};
+
+// generators add their moves to the end of a list, which must be the innermost one (see movelist.h)
+void generate_moves(Movelist &, Legality = LEGAL);
+void generate_captures(Movelist &, Legality = LEGAL);
+void generate_quiets(Movelist &, Legality = LEGAL);
+void generate_evasions(Movelist &);
+void generate_quiet_checks(Movelist &);
+
+// number of legal moves, without generating them
+u64 count_moves();
 
-template<Color, MovegenType = ALL>
-Movelist movegen();
+template<Color, MovegenType = ALL, Legality = LEGAL>
+void movegen(Movelist &);
 
 template <Direction>
 u64 ray_attacks(Square, u64);
@@ -53,4 +75,6 @@ static u64 attack_set(u64, u64);
 template <PieceType, Color>
 static u64 attack_set(u64, u64);
 
-u64 checkers(Color);
+u64 checkers(Board const &, Color);
+void compute_position_info(Board const &, PositionInfo &);
+u64 attackers_to(Board const &, Square, u64);
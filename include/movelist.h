@@ -6,30 +6,75 @@
  * FILE: movelist.h
  * DATE: February 16th, 2022
  * DESCRIPTION: wrapper class for holding all the possible moves in a position
+ * 
+ * Every thread keeps one preallocated stack of moves. A Movelist is a span of that stack: it begins
+ * where the innermost list still alive ends, so the moves of a node sit right above its parent's, and
+ * it is popped when it goes out of scope. Nothing is allocated or copied per node, and a deep search
+ * only ever touches the few kilobytes of stack its current line of play uses.
  */
 #pragma once
 
-#include <array>
+#include <cassert>
 #include <cstddef>
 
 #include "board.h"
 #include "move.h"
 
+// more moves than any position has
 constexpr std::size_t N_MOVES = 256;
 
+// number of moves on each thread's move stack, room for a full list at the root and at every ply of a search
+constexpr std::size_t MOVE_STACK_SIZE = (MAX_PLY + 1) * N_MOVES;
+
+// a move along with its score from move ordering, kept side by side so ordering needs no other storage
+struct ScoredMove
+{
+	Move move;
+	int score = 0;
+
+	inline operator Move() const { return move; }
+};
+
+/*
+ * lists must be local variables, destroyed in the reverse of the order they were made in,
+ * and only the innermost list may have moves added to it
+ */
 class Movelist
 {
 public:
 	Movelist();
+	~Movelist();
+
+	Movelist(Movelist const &)            = delete;
+	Movelist &operator=(Movelist const &) = delete;
+
+	inline void add(Move mv)
+	{
+		assert(innermost == this && last < stack + MOVE_STACK_SIZE);
+		*last++ = { mv, 0 };
+	}
+
+	// removes a move by moving the last move into its place
+	inline void remove(ScoredMove *it)
+	{
+		assert(innermost == this && it >= first && it < last);
+		*it = *--last;
+	}
 
-	void add(Move);
 	void order();
+	void move_to_front(Move);
+
+	inline std::size_t size()  const { return last - first; }
+	inline ScoredMove *begin() const { return first; }
+	inline ScoredMove *end()   const { return last; }
 
-	inline std::size_t size() const { return m_size; }
-	inline std::array<Move, N_MOVES>::const_iterator begin() const { return movelist.begin(); }
-	inline std::array<Move, N_MOVES>::const_iterator end()   const { return movelist.begin() + m_size; }
+	inline ScoredMove &operator[](std::size_t i) const { return first[i]; }
 
 private:
-	std::array<Move, N_MOVES> movelist;
-	std::size_t m_size;
+	ScoredMove *first;
+	ScoredMove *last;
+	Movelist *parent;
+
+	static thread_local ScoredMove stack[MOVE_STACK_SIZE];
+	static thread_local Movelist *innermost;
 };
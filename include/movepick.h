@@ -0,0 +1,103 @@
+/** excalibur
+ * License: GPLv2
+ * See LICENSE for full license text
+ * Author: Sam Kravitz
+ * 
+ * FILE: movepick.h
+ * DATE: October 17th, 2026
+ * DESCRIPTION: hands out the moves of a position one at a time, best first
+ * 
+ * Most nodes of an alpha-beta search are cut off by the first move or two, so generating and
+ * sorting every move is mostly wasted. The move picker works in stages instead: the hash move is
+ * tried before anything is generated, captures are generated before quiet moves, and the next move
+ * of a stage is found by selecting the best remaining one rather than sorting the whole stage.
+ * The moves and their scores live side by side on the thread's move stack (see movelist.h).
+ * 
+ * Main search: hash move, winning captures (MVV-LVA), killers, quiets (history), losing captures
+ * In check:    hash move, evasions (captures by MVV-LVA, then quiets by history)
+ * Quiescence:  hash move, captures (MVV-LVA), then quiet checks at the first quiescence ply
+ * 
+ * A capture is losing if static exchange evaluation says it loses material (see Board::see).
+ * 
+ * Captures and quiet moves are generated pseudo-legally, and each is only tested for legality
+ * when it is handed out, so the moves after a cutoff are never tested at all.
+ * 
+ * https://www.chessprogramming.org/Move_Ordering
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include "board.h"
+#include "move.h"
+#include "movegen.h"
+#include "movelist.h"
+
+// global board object
+extern thread_local Board board;
+
+// how the move picker generates captures and quiet moves, evasions and quiet checks are always legal
+constexpr Legality PICKER_LEGALITY = PSEUDO_LEGAL;
+
+// how much each quiet move has caused beta cutoffs, indexed by color, from, and to square
+using HistoryTable = int[2][64][64];
+
+class MovePicker
+{
+public:
+	MovePicker(Move, Move const *, HistoryTable const &);
+	MovePicker(Move, bool);
+
+	Move next();
+
+private:
+	enum Stage
+	{
+		HASH_MOVE,
+		GENERATE_CAPTURES,
+		WINNING_CAPTURES,
+		KILLERS,
+		QUIETS,
+		LOSING_CAPTURES,
+
+		EVASION_HASH_MOVE,
+		GENERATE_EVASIONS,
+		EVASIONS,
+
+		QS_HASH_MOVE,
+		QS_GENERATE_CAPTURES,
+		QS_CAPTURES,
+		QS_GENERATE_CHECKS,
+		QS_CHECKS,
+
+		DONE,
+	};
+
+	Stage stage;
+	bool evading;
+	Move hash_move;
+	Move killers[2];
+	int killer_index;
+	HistoryTable const *history;
+	bool with_checks;
+
+	// every move generated so far along with its score, on the thread's move stack.
+	// the current stage hands out the moves from cur to end, moves before cur have been handed out
+	Movelist moves;
+	std::size_t cur;
+	std::size_t end;
+
+	// captures that lose material, set apart from the others until the last stage
+	std::size_t losing_begin;
+	std::size_t losing_end;
+
+	void generated(std::size_t);
+	void add_captures(bool);
+	void add_quiets();
+	void add_evasions();
+	void add_quiet_checks();
+	Move pick();
+	Move select();
+	bool take(Move);
+};
@@ -10,24 +10,30 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <iostream>
+#include <memory>
 #include <string>
 
+#include "movegen.h"
+#include "types.h"
+
 // global board object
 class Board;
-extern Board board;
+extern thread_local Board board;
 
 struct PerftDetail
 {
-	int nodes             = 0;
-	int captures          = 0;
-	int enpassants        = 0;
-	int castles           = 0;
-	int promotions        = 0;
-	int checks            = 0;
-	int discovered_checks = 0;
-	int double_checks     = 0;
-	int checkmates        = 0;
+	u64 nodes             = 0;
+	u64 captures          = 0;
+	u64 enpassants        = 0;
+	u64 castles           = 0;
+	u64 promotions        = 0;
+	u64 checks            = 0;
+	u64 discovered_checks = 0;
+	u64 double_checks     = 0;
+	u64 checkmates        = 0;
 
 	friend std::ostream &operator<<(std::ostream &os, const PerftDetail &pd)
 	{
@@ -46,5 +52,40 @@ struct PerftDetail
 	}
 };
 
-int perft(int, std::string fen = "");
+/*
+ * caches the node count below positions already counted, keyed by zobrist key and depth.
+ * the same position is reached by many move orders, so deep perfts collapse by orders of magnitude.
+ * 
+ * threads share the table without locking: each entry stores its key xor'd with its data, so an
+ * entry torn by two threads writing it at once fails to verify and is a miss.
+ */
+class PerftTable
+{
+public:
+	PerftTable(std::size_t);
+
+	bool probe(u64, int, u64 &);
+	void store(u64, int, u64);
+
+	void add_stats(u64, u64);
+	double hit_rate() const;
+
+private:
+	// data is nodes << 8 | depth
+	struct Entry
+	{
+		std::atomic<u64> key;
+		std::atomic<u64> data;
+	};
+
+	std::unique_ptr<Entry[]> entries;
+	std::size_t count;
+
+	std::atomic<u64> probes = 0;
+	std::atomic<u64> hits   = 0;
+};
+
+u64 perft(int, std::string fen = "", Legality legality = LEGAL);
+u64 perft_parallel(int, int, std::string fen = "", PerftTable *table = nullptr, Legality legality = LEGAL);
 PerftDetail perft_detail(int, std::string fen = "");
+void perft_bench(int);
@@ -6,16 +6,30 @@
  * FILE: polyglot.h
  * DATE: November 14th, 2022
  * DESCRIPTION: Implements the polyglot opening book binary format
+ * 
+ * A polyglot book is an array of 16 byte big-endian entries sorted by the zobrist key of the
+ * position. The book is memory mapped once when it is opened and probed with a binary search,
+ * so a lookup touches only a handful of pages however large the book is.
+ * 
+ * http://hgm.nubati.net/book_format.html
  */
 
 #pragma once
 
-#include <unordered_map>
+#include <cstddef>
+#include <string>
+#include <vector>
 
 #include "board.h"
 #include "move.h"
 #include "types.h"
 
+// global board object
+extern thread_local Board board;
+
+// book opened at startup unless another is given
+constexpr const char *DEFAULT_BOOK = "./book/baron30.bin";
+
 struct PolyglotEntry
 {
 	u64 key;
@@ -24,4 +38,29 @@ struct PolyglotEntry
 	u32 learn;
 };
 
-Move polyglot(Board const &);
+static_assert(sizeof(PolyglotEntry) == 16);
+
+class PolyglotBook
+{
+public:
+	PolyglotBook() = default;
+	PolyglotBook(PolyglotBook const &) = delete;
+	PolyglotBook &operator=(PolyglotBook const &) = delete;
+	~PolyglotBook();
+
+	bool open(std::string const &);
+	void close();
+	inline bool is_open() const { return entries != nullptr; }
+
+	std::vector<PolyglotEntry> probe(u64) const;
+
+private:
+	PolyglotEntry const *entries = nullptr;    // entries as they are in the file, big-endian
+	std::size_t count            = 0;
+	std::size_t size             = 0;          // size of the mapping in bytes
+};
+
+// global opening book
+extern PolyglotBook book;
+
+Move polyglot();
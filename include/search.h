@@ -10,18 +10,116 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <functional>
+#include <thread>
 #include <tuple>
+#include <vector>
 
+#include "board.h"
 #include "move.h"
+#include "types.h"
 
 // global board object
-class Board;
-extern Board board;
+extern thread_local Board board;
 
-float alphabeta(int, float, float);
-float quiesce(float, float);
+// deepest iteration a search will start
+constexpr int MAX_DEPTH = 64;
+
+// the quiescence search goes no further than MAX_PLY from the root
+static_assert(MAX_DEPTH < MAX_PLY);
+
+// score of the side to move being checkmated, a mate n ply from the root scores -MATE + n.
+// no position is searched more than MAX_PLY ply from the root, so any score beyond MATE_BOUND is a mate
+constexpr float MATE       = 10000;
+constexpr float MATE_BOUND = MATE - MAX_PLY;
+
+// limits on a search, a limit of 0 means no limit
+struct SearchLimits
+{
+	int depth     = 0;
+	u64 nodes     = 0;
+	int movetime  = 0;        // milliseconds
+	bool infinite = false;    // do not finish until stopped, even if there is nothing left to search
+};
+
+// progress of a search, reported every time the main thread completes an iteration
+struct SearchInfo
+{
+	int depth;
+	float score;
+	u64 nodes;
+	std::chrono::milliseconds time;
+	std::vector<Move> pv;    // principal variation
+};
+
+/*
+ * lazy smp: every thread searches the whole tree from the root on its own copy of the board,
+ * sharing only the transposition table. threads speed each other up by filling the table
+ * with results the others can reuse.
+ * https://www.chessprogramming.org/Lazy_SMP
+ */
+struct SearchThread
+{
+	int id;            // 0 is the main thread
+	Move best_move;    // best move of the deepest completed iteration
+	float max;         // score of best_move
+	int depth;         // deepest iteration searched completely
+};
+
+/*
+ * runs searches in the background. search threads poll the controller every few thousand nodes,
+ * which is when the main thread checks the limits and every thread notices a stop request.
+ * results are only published once an iteration has been searched completely, so a stopped search
+ * never returns a move from a half searched iteration.
+ */
+class SearchController
+{
+public:
+	using InfoCallback = std::function<void(SearchInfo const &)>;
+	using DoneCallback = std::function<void(Move, float)>;
+
+	~SearchController();
+
+	void start(Board const &, SearchLimits const &, InfoCallback = nullptr, DoneCallback = nullptr);
+	void stop();
+	void wait();
+
+	std::tuple<Move, float> result() const;
+
+	void set_threads(int);
+
+	// called by search threads
+	bool poll(SearchThread const &, u64);
+	u64 nodes() const { return nodes_searched.load(std::memory_order_relaxed); }
+
+private:
+	Board root;
+	SearchLimits limits;
+	std::chrono::steady_clock::time_point start_time;
+	InfoCallback on_iteration;
+	DoneCallback on_done;
+
+	int num_threads = 1;
+	std::vector<SearchThread> threads;
+	std::thread main_thread;
+
+	std::atomic<bool> stop_search = false;
+	std::atomic<u64> nodes_searched = 0;
+
+	void run();
+	void iterative_deepening(SearchThread &);
+	void report(SearchThread const &);
+};
+
+// global search controller
+extern SearchController searcher;
+
+float alphabeta(int, int, float, float);
+float quiesce(float, float, int, int);
 std::tuple<Move, float> search(int);
 std::tuple<Move, float> search_time(int, int);
+void search_bench(int);
 
 float evaluate();
@@ -0,0 +1,103 @@
+/** excalibur
+ * License: GPLv2
+ * See LICENSE for full license text
+ * Author: Sam Kravitz
+ * 
+ * FILE: tt.h
+ * DATE: October 17th, 2026
+ * DESCRIPTION: transposition table for storing search results
+ * 
+ * The same position is often reached through different move orders, and iterative deepening
+ * searches the same tree over and over. The transposition table remembers the result of each
+ * searched position, keyed by its zobrist key, so the search can reuse a previous result or at
+ * least try the previously best move first.
+ * 
+ * The table is a power-of-two number of 64 byte buckets, each holding 4 entries, so a probe
+ * touches a single cache line.
+ * 
+ * All search threads share one table without locking. Each entry stores its key xor'd with its
+ * data, so an entry torn by two threads writing it at the same time no longer verifies and is
+ * simply treated as a miss.
+ * 
+ * https://www.chessprogramming.org/Transposition_Table
+ * https://www.chessprogramming.org/Shared_Hash_Table#Lockless
+ */
+
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+
+#include "move.h"
+#include "types.h"
+
+constexpr std::size_t DEFAULT_HASH_MB = 16;
+
+// what the stored score says about the true score of the position
+enum Bound : u8
+{
+	BOUND_NONE  = 0,
+	BOUND_UPPER = 1,    // search failed low, true score <= score
+	BOUND_LOWER = 2,    // search failed high, true score >= score
+	BOUND_EXACT = 3,    // true score == score
+};
+
+/*
+ * an entry is the full 64 bit key of the position used to verify a hit, plus the data packed into 64 bits:
+ * bits 0-15 best move, bits 16-23 depth, bits 24-25 bound, bits 26-31 generation, bits 32-63 score
+ */
+struct TTEntry
+{
+	u64 key;
+	u64 data;
+
+	inline Move move()      const { return Move(static_cast<int>(data & 0xffff)); }
+	inline int depth()      const { return data >> 16 & 0xff; }
+	inline Bound bound()    const { return static_cast<Bound>(data >> 24 & 0x3); }
+	inline u8 generation()  const { return data >> 26 & 0x3f; }
+	inline float score()    const { return std::bit_cast<float>(static_cast<u32>(data >> 32)); }
+};
+
+// an entry as it is kept in the table, the key is stored as key ^ data
+struct TTSlot
+{
+	std::atomic<u64> key;
+	std::atomic<u64> data;
+};
+
+struct alignas(64) TTBucket
+{
+	TTSlot entries[4];
+};
+
+class TranspositionTable
+{
+public:
+	TranspositionTable();
+
+	void resize(std::size_t);
+	void clear();
+	void new_search();
+	void add_thread_stats();
+
+	bool probe(u64, TTEntry &);
+	void store(u64, int, Bound, float, Move);
+
+	int hashfull() const;
+	double hit_rate() const;
+
+private:
+	std::unique_ptr<TTBucket[]> buckets;
+	std::size_t count;
+	u8 generation;
+
+	std::atomic<u64> probes = 0;
+	std::atomic<u64> hits   = 0;
+
+	inline TTBucket &bucket(u64 key) { return buckets[key & (count - 1)]; }
+};
+
+// global transposition table
+extern TranspositionTable tt;
@@ -13,10 +13,11 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 // global board object
 class Board;
-extern Board board;
+extern thread_local Board board;
 
 // Types of messages GUI can send to engine
 enum UciType
@@ -37,5 +38,9 @@ enum UciType
 };
 
 void uci();
+void uci_position(std::vector<std::string> const &);
+void uci_go(std::vector<std::string> const &);
+int time_budget(int, int, int);
+std::string uci_score(float);
 UciType decode_msg(std::string const &);
 void send_msg(std::string const &);
@@ -179,3 +179,30 @@ constexpr int TURN_OFFSET = 780;
 
 
 u64 zobrist(Board const &);
+
+/*
+ * keys of the individual parts of a position, used to update a position's key incrementally.
+ * xoring a key in and out of a position's key adds or removes that part of the position
+ */
+namespace Zobrist
+{
+	// polyglot orders pieces pawn, knight, bishop, rook, queen, king with black before white
+	constexpr int POLYGLOT_PIECE[6] = {
+		0, // PAWN
+		2, // BISHOP
+		1, // KNIGHT
+		3, // ROOK
+		4, // QUEEN
+		5, // KING
+	};
+
+	inline u64 piece(PieceType pt, Color c, Square square)
+	{
+		int kind_of_piece = 2 * POLYGLOT_PIECE[pt] + (c == WHITE ? 1 : 0);
+		return random64[PIECE_OFFSET + 64 * kind_of_piece + square];
+	}
+
+	inline u64 castle(Color c, CastleTypes ct) { return random64[CASTLE_OFFSET + 2 * c + ct]; }
+	inline u64 enpassant(Square ep_sq) { return random64[ENPASSANT_OFFSET + ep_sq % 8]; }
+	inline u64 turn() { return random64[TURN_OFFSET]; }
+}
@@ -10,6 +10,8 @@
 
 #include "board.h"
 
+#include <algorithm>
+#include <array>
 #include <bit>
 #include <cassert>
 #include <cstring>
@@ -18,6 +20,7 @@
 #include "constants.h"
 #include "movegen.h"
 #include "util.h"
+#include "zobrist.h"
 
 /*
  * this array holds the squares a rook will move to when castling.
@@ -40,38 +43,85 @@ constexpr Square castle_squares[2][2][2] = {
     }
 };
 
-Board::Board()
+// how much each piece type counts towards the game phase
+constexpr int PHASE_WEIGHT[6] = {
+    0, // PAWN
+    1, // BISHOP
+    1, // KNIGHT
+    2, // ROOK
+    4, // QUEEN
+    0, // KING
+};
+
+/*
+ * score of each piece type of each color on each square, from white's point of view.
+ * so far it is only the material value of the piece, the same on every square and in both phases.
+ * piece-square terms are added to white's pieces here and mirrored for black's
+ */
+constexpr auto PSQ = []
 {
-    reset();
-}
+    std::array<std::array<std::array<Score, 64>, 6>, 2> psq {};
+
+    for (int pt = PAWN; pt < KING; pt++)
+    {
+        for (int sq = 0; sq < 64; sq++)
+        {
+            float value = Constants::PIECE_VALUE[pt];
+
+            psq[WHITE][pt][sq]      = { value, value };
+            psq[BLACK][pt][sq ^ 56] = { -value, -value };
+        }
+    }
+
+    return psq;
+}();
 
 /**
  * @brief returns board to initial position of a chess game
  */
 void Board::reset()
 {
-    piece_bb[PAWN]   = Constants::WPAWNS_INIT   | Constants::BPAWNS_INIT;
-    piece_bb[KNIGHT] = Constants::WKNIGHTS_INIT | Constants::BKNIGHTS_INIT;
-    piece_bb[BISHOP] = Constants::WBISHOPS_INIT | Constants::BBISHOPS_INIT;
-    piece_bb[ROOK]   = Constants::WROOKS_INIT   | Constants::BROOKS_INIT;
-    piece_bb[QUEEN]  = Constants::WQUEENS_INIT  | Constants::BQUEENS_INIT;
-    piece_bb[KING]   = Constants::WKING_INIT    | Constants::BKING_INIT;
+    // reset undo history, first so the pieces are placed on the first ply
+    game_ply = 0;
+    state().captured = NONE;
+
+    pos().piece_bb[PAWN]   = Constants::WPAWNS_INIT   | Constants::BPAWNS_INIT;
+    pos().piece_bb[KNIGHT] = Constants::WKNIGHTS_INIT | Constants::BKNIGHTS_INIT;
+    pos().piece_bb[BISHOP] = Constants::WBISHOPS_INIT | Constants::BBISHOPS_INIT;
+    pos().piece_bb[ROOK]   = Constants::WROOKS_INIT   | Constants::BROOKS_INIT;
+    pos().piece_bb[QUEEN]  = Constants::WQUEENS_INIT  | Constants::BQUEENS_INIT;
+    pos().piece_bb[KING]   = Constants::WKING_INIT    | Constants::BKING_INIT;
 
-    color_bb[WHITE]  = Constants::WPAWNS_INIT | Constants::WKNIGHTS_INIT | Constants::WBISHOPS_INIT | Constants::WROOKS_INIT | Constants::WQUEENS_INIT | Constants::WKING_INIT;
-    color_bb[BLACK]  = Constants::BPAWNS_INIT | Constants::BKNIGHTS_INIT | Constants::BBISHOPS_INIT | Constants::BROOKS_INIT | Constants::BQUEENS_INIT | Constants::BKING_INIT;
+    pos().color_bb[WHITE]  = Constants::WPAWNS_INIT | Constants::WKNIGHTS_INIT | Constants::WBISHOPS_INIT | Constants::WROOKS_INIT | Constants::WQUEENS_INIT | Constants::WKING_INIT;
+    pos().color_bb[BLACK]  = Constants::BPAWNS_INIT | Constants::BKNIGHTS_INIT | Constants::BBISHOPS_INIT | Constants::BROOKS_INIT | Constants::BQUEENS_INIT | Constants::BKING_INIT;
 
-    std::memcpy(board, Constants::BOARD_INIT, sizeof(board));
+    for (int i = 0; i < 64; i++)
+        pos().board[i] = mailbox_entry(Constants::BOARD_INIT[i], i < 32 ? WHITE : BLACK);
 
     to_move = WHITE;
 
     // reset castling rights
-    castle_rights[WHITE][KINGSIDE]  = true;
-    castle_rights[WHITE][QUEENSIDE] = true;
-    castle_rights[BLACK][KINGSIDE]  = true;
-    castle_rights[BLACK][QUEENSIDE] = true;
+    state().castle_rights = castle_bit(WHITE, KINGSIDE) | castle_bit(WHITE, QUEENSIDE) |
+                            castle_bit(BLACK, KINGSIDE) | castle_bit(BLACK, QUEENSIDE);
 
     // reset enpassant square
-    ep_sq = EP_NONE;
+    state().ep_sq = EP_NONE;
+
+    // sum the score and phase of the starting pieces
+    state().psq   = {};
+    state().phase = 0;
+    for (int i = 0; i < 64; i++)
+    {
+        auto sq = static_cast<Square>(i);
+        if (piece_on(sq) != NONE)
+        {
+            state().psq   += PSQ[color_on(sq)][piece_on(sq)][sq];
+            state().phase += PHASE_WEIGHT[piece_on(sq)];
+        }
+    }
+
+    state().key = zobrist(*this);
+    invalidate_info();
 }
 
 /**
@@ -79,41 +129,154 @@ void Board::reset()
  */
 void Board::clear()
 {
+    // clear undo history, first so the pieces are cleared on the first ply
+    game_ply = 0;
+    state().captured = NONE;
+
     // clear board
     for (int i = 0; i < 64; i++)
-        board[i] = NONE;
+        pos().board[i] = NONE;
     
     // clear piece bb
     for (int i = 0; i < 6; i++)
-        piece_bb[i] = 0;
+        pos().piece_bb[i] = 0;
     
     // clear color bb
-    color_bb[0] = 0;
-    color_bb[1] = 0;
+    pos().color_bb[0] = 0;
+    pos().color_bb[1] = 0;
 
     // clear castling rights
-    castle_rights[WHITE][KINGSIDE]  = false;
-    castle_rights[WHITE][QUEENSIDE] = false;
-    castle_rights[BLACK][KINGSIDE]  = false;
-    castle_rights[BLACK][QUEENSIDE] = false;
+    state().castle_rights = 0;
+
+    state().psq   = {};
+    state().phase = 0;
 
     // clear enpassant square
-    ep_sq = EP_NONE;
+    state().ep_sq = EP_NONE;
+
+    // only the side to move is left in the key of an empty board
+    state().key = to_move == WHITE ? Zobrist::turn() : 0;
+    invalidate_info();
 }
 
 void Board::set_piece(PieceType pt, Square square, Color c)
 {
-    board[square] = pt;
-    piece_bb[pt] |= square;
-    color_bb[c]  |= square;
+    pos().board[square] = mailbox_entry(pt, c);
+
+    state().psq   += PSQ[c][pt][square];
+    state().phase += PHASE_WEIGHT[pt];
+    pos().piece_bb[pt] |= square;
+    pos().color_bb[c]  |= square;
+
+    state().key ^= Zobrist::piece(pt, c, square);
+    invalidate_info();
 }
 
 void Board::set_to_move(Color c)
 {
+    if (c != to_move)
+        state().key ^= Zobrist::turn();
+
     to_move = c;
+    invalidate_info();
 }
 
-void Board::make_move(Move const &move)
+void Board::set_castle_rights(Color c, CastleTypes ct)
+{
+    if (!get_castle_rights(c, ct))
+        state().key ^= Zobrist::castle(c, ct);
+
+    state().castle_rights |= castle_bit(c, ct);
+}
+
+void Board::clear_castle_rights(Color c, CastleTypes ct)
+{
+    if (get_castle_rights(c, ct))
+        state().key ^= Zobrist::castle(c, ct);
+
+    state().castle_rights &= ~castle_bit(c, ct);
+}
+
+/*
+ * castle rights kept by a move from or to each square: a king move gives up both of its castles,
+ * and moving or capturing a rook on its original square gives up the castle on its side
+ */
+constexpr std::array<u8, 64> CASTLE_RIGHTS_KEPT = []
+{
+    std::array<u8, 64> kept {};
+    kept.fill(0xf);
+
+    for (Color c : { WHITE, BLACK })
+    {
+        kept[c == WHITE ? E1 : E8] &= ~(castle_bit(c, KINGSIDE) | castle_bit(c, QUEENSIDE));
+        kept[castle_squares[c][KINGSIDE][0]]  &= ~castle_bit(c, KINGSIDE);
+        kept[castle_squares[c][QUEENSIDE][0]] &= ~castle_bit(c, QUEENSIDE);
+    }
+
+    return kept;
+}();
+
+/**
+ * @brief gives up the castle rights lost by a move
+ * @param from origin square of the move
+ * @param to destination square of the move
+ */
+void Board::update_castle_rights(Square from, Square to)
+{
+    u8 lost = state().castle_rights & ~(CASTLE_RIGHTS_KEPT[from] & CASTLE_RIGHTS_KEPT[to]);
+    if (!lost)
+        return;
+
+    state().castle_rights ^= lost;
+
+    for (u8 bits = lost; bits; bits &= bits - 1)
+    {
+        int bit = std::countr_zero(bits);
+        state().key ^= Zobrist::castle(static_cast<Color>(bit / 2), static_cast<CastleTypes>(bit % 2));
+    }
+}
+
+/**
+ * @brief sets the enpassant square of the position
+ * @param sq the square behind the pawn that just made a double push
+ * 
+ * like make_move, the square is only kept if a pawn of the side to move is next to the pushed pawn
+ * and could capture it, which matches when polyglot includes enpassant in the key.
+ * the pieces and side to move must already be set
+ */
+void Board::set_ep_sq(Square sq)
+{
+    if (state().ep_sq != EP_NONE)
+        state().key ^= Zobrist::enpassant(get_ep_sq());
+
+    state().ep_sq = EP_NONE;
+
+    if (sq == EP_NONE)
+        return;
+
+    // square of the pawn that made the double push
+    Square pushed = mover() == WHITE ? static_cast<Square>(sq - 8) : static_cast<Square>(sq + 8);
+
+    u64 neighbors = 0;
+    if (~Bitboard::FILE_BB[FILE_A] & pushed)
+        neighbors |= static_cast<Square>(pushed - 1);
+    if (~Bitboard::FILE_BB[FILE_H] & pushed)
+        neighbors |= static_cast<Square>(pushed + 1);
+
+    if (neighbors & pieces(PAWN, mover()))
+    {
+        state().ep_sq = sq;
+        state().key ^= Zobrist::enpassant(sq);
+    }
+}
+
+/**
+ * @brief makes a move, the generic version
+ * @param move a legal move of this position
+ * 
+ * tests for every special case of a move at run time, see make_move for the version the engine uses
+ */
+void Board::make_move_generic(Move const &move)
 {
     // save irreversable state
     save();
@@ -127,13 +290,32 @@ void Board::make_move(Move const &move)
     // make sure there is an actual piece on that square
     assert(moved_piece != NONE);
 
+    // the side to move changes on every move
+    state().key ^= Zobrist::turn();
+
     // update castle rights
-    if (moved_piece == KING || moved_piece == ROOK)
+    if (moved_piece == KING)
     {
-        castle_rights[mover()][KINGSIDE]  = false;
-        castle_rights[mover()][QUEENSIDE] = false;
+        clear_castle_rights(mover(), KINGSIDE);
+        clear_castle_rights(mover(), QUEENSIDE);
+    }
+
+    // a rook only gives up the castle rights on its own side
+    if (moved_piece == ROOK)
+    {
+        if (from == castle_squares[mover()][KINGSIDE][0])
+            clear_castle_rights(mover(), KINGSIDE);
+
+        if (from == castle_squares[mover()][QUEENSIDE][0])
+            clear_castle_rights(mover(), QUEENSIDE);
     }
 
+    // clear enpassant square
+    if (state().ep_sq != EP_NONE)
+        state().key ^= Zobrist::enpassant(get_ep_sq());
+
+    state().ep_sq = EP_NONE;
+
     // update enpassant square
     if (move.flags() == DOUBLE_PAWN_PUSH)
     {
@@ -145,8 +327,8 @@ void Board::make_move(Move const &move)
             Square one_left = static_cast<Square>(to - 1);
 
             // there is an enemy pawn immediately to the left of us
-            if (color_bb[~mover()] & piece_bb[PAWN] & one_left)
-                ep_sq = mover() == WHITE ? static_cast<Square>(to - 8) : static_cast<Square>(to + 8);
+            if (pos().color_bb[~mover()] & pos().piece_bb[PAWN] & one_left)
+                state().ep_sq = mover() == WHITE ? static_cast<Square>(to - 8) : static_cast<Square>(to + 8);
         }
 
         // moved pawn is not on H file
@@ -155,15 +337,12 @@ void Board::make_move(Move const &move)
             Square one_right = static_cast<Square>(to + 1);
 
             // there is an enemy pawn immediately to the right of us
-            if (color_bb[~mover()] & piece_bb[PAWN] & one_right)
-                ep_sq = mover() == WHITE ? static_cast<Square>(to - 8) : static_cast<Square>(to + 8);
+            if (pos().color_bb[~mover()] & pos().piece_bb[PAWN] & one_right)
+                state().ep_sq = mover() == WHITE ? static_cast<Square>(to - 8) : static_cast<Square>(to + 8);
         }
-    }
 
-    // clear enpassant square
-    else
-    {
-        ep_sq = EP_NONE;
+        if (state().ep_sq != EP_NONE)
+            state().key ^= Zobrist::enpassant(get_ep_sq());
     }
 
     // do enpassant
@@ -179,12 +358,15 @@ void Board::make_move(Move const &move)
         bb |= captured_square;
 
         // clear the captured square on the piece bitboard
-        piece_bb[PAWN] &= ~bb;
+        pos().piece_bb[PAWN] &= ~bb;
 
         // clear the captured square on the color bitboard
-        color_bb[~mover()] &= ~bb;
+        pos().color_bb[~mover()] &= ~bb;
+
+        pos().board[captured_square] = NONE;
 
-        board[captured_square] = NONE;
+        state().key ^= Zobrist::piece(PAWN, ~mover(), captured_square);
+        state().psq -= PSQ[~mover()][PAWN][captured_square];
     }
 
     // do castle
@@ -197,28 +379,36 @@ void Board::make_move(Move const &move)
         Square rnew = castle_squares[mover()][idx][1];
 
         // update the board array
-        board[knew] = KING;
-        board[kold] = NONE;
-        board[rnew] = ROOK;
-        board[rold] = NONE;
+        pos().board[knew] = mailbox_entry(KING, mover());
+        pos().board[kold] = NONE;
+        pos().board[rnew] = mailbox_entry(ROOK, mover());
+        pos().board[rold] = NONE;
 
         // clear the old king square on the piece bitboard
-        piece_bb[KING] ^= kold;
+        pos().piece_bb[KING] ^= kold;
         // clear the old rook square on the piece bitboard
-        piece_bb[ROOK] ^= rold;
+        pos().piece_bb[ROOK] ^= rold;
         // set the new king square on the piece bitboard
-        piece_bb[KING] |= knew;
+        pos().piece_bb[KING] |= knew;
         // set the new rook square on the piece bitboard
-        piece_bb[ROOK] |= rnew;
+        pos().piece_bb[ROOK] |= rnew;
 
         // clear the old king square on the color bitboard
-        color_bb[mover()] ^= kold;
+        pos().color_bb[mover()] ^= kold;
         // clear the old rook square on the color bitboard
-        color_bb[mover()] ^= rold;
+        pos().color_bb[mover()] ^= rold;
         // set the new king square on the color bitboard
-        color_bb[mover()] |= knew;
+        pos().color_bb[mover()] |= knew;
         // set the new rook square on the color bitboard
-        color_bb[mover()] |= rnew;
+        pos().color_bb[mover()] |= rnew;
+
+        state().key ^= Zobrist::piece(KING, mover(), kold) ^ Zobrist::piece(KING, mover(), knew);
+        state().key ^= Zobrist::piece(ROOK, mover(), rold) ^ Zobrist::piece(ROOK, mover(), rnew);
+
+        state().psq -= PSQ[mover()][KING][kold];
+        state().psq += PSQ[mover()][KING][knew];
+        state().psq -= PSQ[mover()][ROOK][rold];
+        state().psq += PSQ[mover()][ROOK][rnew];
 
         // switch the player to move
         to_move = ~to_move;
@@ -231,39 +421,47 @@ void Board::make_move(Move const &move)
         // save type of piece on the captured square
         auto captured_piece = piece_on(to);
         assert(captured_piece != NONE);
-        capture_stack.push(captured_piece);
+        state().captured = captured_piece;
 
         // determine if this capture changes castling rights
         if (captured_piece == ROOK)
         {
-            if (to == H1 || to == H8)
-                castle_rights[~mover()][KINGSIDE] = false;
+            if (to == castle_squares[~mover()][KINGSIDE][0])
+                clear_castle_rights(~mover(), KINGSIDE);
             
-            if (to == A1 || to == A8)
-                castle_rights[~mover()][QUEENSIDE] = false;
+            if (to == castle_squares[~mover()][QUEENSIDE][0])
+                clear_castle_rights(~mover(), QUEENSIDE);
         }
 
         // unset the captured square
-        piece_bb[captured_piece] ^= to;
+        pos().piece_bb[captured_piece] ^= to;
 
         // unset the captured square on the color bb
-        color_bb[~mover()] ^= to;
+        pos().color_bb[~mover()] ^= to;
+
+        state().key ^= Zobrist::piece(captured_piece, ~mover(), to);
+        state().psq -= PSQ[~mover()][captured_piece][to];
+        state().phase -= PHASE_WEIGHT[captured_piece];
     }
 
-    board[from] = NONE;
-    board[to] = moved_piece;
+    pos().board[from] = NONE;
+    pos().board[to] = mailbox_entry(moved_piece, mover());
 
     // clear the origin square on the bitboard of the moved piece
-    piece_bb[moved_piece] ^= from;
+    pos().piece_bb[moved_piece] ^= from;
 
     // clear the origin square on the color bitboard of the moved piece
-    color_bb[mover()] ^= from;
+    pos().color_bb[mover()] ^= from;
 
     // set the destination square on the bitboard of the moved piece
-    piece_bb[moved_piece] |= to;
+    pos().piece_bb[moved_piece] |= to;
 
     // set the destination square on the color bitboard of the moved piece
-    color_bb[mover()] |= to;
+    pos().color_bb[mover()] |= to;
+
+    state().key ^= Zobrist::piece(moved_piece, mover(), from) ^ Zobrist::piece(moved_piece, mover(), to);
+    state().psq -= PSQ[mover()][moved_piece][from];
+    state().psq += PSQ[mover()][moved_piece][to];
 
     if (move.is_promotion())
     {
@@ -291,24 +489,39 @@ void Board::make_move(Move const &move)
                 break;
         }
 
-        // clear the origin square on the bitboard of the promoted pawn
-        piece_bb[PAWN] ^= from;
-
         // set the destination square on the bitboard of the promoted piece
-        piece_bb[promoted_to] |= to;
+        pos().piece_bb[promoted_to] |= to;
 
         // clear the destination square on the bitboard of the promoted pawn
-        piece_bb[PAWN] ^= to;
+        pos().piece_bb[PAWN] ^= to;
+
+        pos().board[to] = mailbox_entry(promoted_to, mover());
 
-        board[to] = promoted_to;
+        state().key ^= Zobrist::piece(PAWN, mover(), to) ^ Zobrist::piece(promoted_to, mover(), to);
+        state().psq -= PSQ[mover()][PAWN][to];
+        state().psq += PSQ[mover()][promoted_to][to];
+        state().phase += PHASE_WEIGHT[promoted_to];
     }
 
     // switch the player to move
     to_move = ~to_move;
 }
 
-void Board::undo_move(Move const &move)
+/**
+ * @brief undoes the last move made with make_move_generic
+ */
+void Board::undo_move_generic(Move const &move)
 {
+    if constexpr (COPY_MAKE_BOARD)
+    {
+        restore();
+        to_move = ~to_move;
+        return;
+    }
+
+    // type of the piece captured by this move, if any
+    auto captured_piece = static_cast<PieceType>(state().captured);
+
     // restore irreversable state
     restore();
 
@@ -334,12 +547,12 @@ void Board::undo_move(Move const &move)
         Square captured_square = mover() == WHITE ? static_cast<Square>(new_square + 8) : static_cast<Square>(new_square - 8);
 
         // set the captured square on the piece bitboard
-        piece_bb[PAWN] |= captured_square;
+        pos().piece_bb[PAWN] |= captured_square;
 
         // set the captured square on the color bitboard
-        color_bb[~moved_color] |= captured_square;
+        pos().color_bb[~moved_color] |= captured_square;
 
-        board[captured_square] = PAWN;
+        pos().board[captured_square] = mailbox_entry(PAWN, ~moved_color);
     }
 
     // undo castle
@@ -352,28 +565,28 @@ void Board::undo_move(Move const &move)
         Square rnew = castle_squares[moved_color][idx][1];
 
         // update the board array
-        board[kold] = KING;
-        board[knew] = NONE;
-        board[rold] = ROOK;
-        board[rnew] = NONE;
+        pos().board[kold] = mailbox_entry(KING, moved_color);
+        pos().board[knew] = NONE;
+        pos().board[rold] = mailbox_entry(ROOK, moved_color);
+        pos().board[rnew] = NONE;
 
         // clear the old king square on the piece bitboard
-        piece_bb[KING] ^= knew;
+        pos().piece_bb[KING] ^= knew;
         // clear the old rook square on the piece bitboard
-        piece_bb[ROOK] ^= rnew;
+        pos().piece_bb[ROOK] ^= rnew;
         // set the new king square on the piece bitboard
-        piece_bb[KING] |= kold;
+        pos().piece_bb[KING] |= kold;
         // set the new rook square on the piece bitboard
-        piece_bb[ROOK] |= rold;
+        pos().piece_bb[ROOK] |= rold;
 
         // clear the old king square on the color bitboard
-        color_bb[moved_color] ^= knew;
+        pos().color_bb[moved_color] ^= knew;
         // clear the old rook square on the color bitboard
-        color_bb[moved_color] ^= rnew;
+        pos().color_bb[moved_color] ^= rnew;
         // set the new king square on the color bitboard
-        color_bb[moved_color] |= kold;
+        pos().color_bb[moved_color] |= kold;
         // set the new rook square on the color bitboard
-        color_bb[moved_color] |= rold;
+        pos().color_bb[moved_color] |= rold;
 
         // switch the player to move
         to_move = ~to_move;
@@ -381,68 +594,383 @@ void Board::undo_move(Move const &move)
         return;
     }
 
-    board[old_square] = moved_piece;
-    board[new_square] = NONE;
+    pos().board[old_square] = mailbox_entry(moved_piece, moved_color);
+    pos().board[new_square] = NONE;
 
     // clear the square that the piece moved to
-    piece_bb[moved_piece] ^= new_square;
+    pos().piece_bb[moved_piece] ^= new_square;
 
     // clear the square that the piece moved to on the color bb
-    color_bb[moved_color] ^= new_square;
+    pos().color_bb[moved_color] ^= new_square;
 
     // set the square that the piece originally was on
-    piece_bb[moved_piece] |= old_square;
+    pos().piece_bb[moved_piece] |= old_square;
 
     // set the square that the piece originally was on on the color bb
-    color_bb[moved_color] |= old_square;
+    pos().color_bb[moved_color] |= old_square;
 
     if (move.is_capture())
     {
-        // pop the topmost captured piece from stack
-        auto captured_piece = capture_stack.top();
-        capture_stack.pop();
         assert(captured_piece != NONE);
-        board[new_square] = captured_piece;
+        pos().board[new_square] = mailbox_entry(captured_piece, ~moved_color);
 
         // set the square that the captured piece was on
-        piece_bb[captured_piece] |= new_square;
+        pos().piece_bb[captured_piece] |= new_square;
 
         // set the square that the captured piece was on color bb
-        color_bb[~moved_color] |= new_square;
-        captured_piece = NONE;
+        pos().color_bb[~moved_color] |= new_square;
     }
 
     if (move.is_promotion())
     {
-        // clear the promoted piece
-        piece_bb[moved_piece] ^= old_square;
+        // clear the promoted piece (it was moved back to old_square above)
+        pos().piece_bb[moved_piece] ^= old_square;
 
         // set the pawn bitboard for old_sqaure (we are un-promoting it)
-        piece_bb[PAWN] |= old_square;
+        pos().piece_bb[PAWN] |= old_square;
 
-        board[old_square] = PAWN;
+        pos().board[old_square] = mailbox_entry(PAWN, moved_color);
     }
 
     // switch the player to move
     to_move = ~to_move;
 }
 
+// class of each move flag, indexed by the flag
+constexpr MoveClass MOVE_CLASS[16] = {
+    MoveClass::QUIET,        // QUIET_MOVE
+    MoveClass::DOUBLE_PUSH,  // DOUBLE_PAWN_PUSH
+    MoveClass::CASTLE,       // KINGSIDE_CASTLE
+    MoveClass::CASTLE,       // QUEENSIDE_CASTLE
+    MoveClass::CAPTURE,      // CAPTURE
+    MoveClass::ENPASSANT,    // ENPASSANT
+    MoveClass::QUIET,        // unused
+    MoveClass::QUIET,        // unused
+    MoveClass::PROMOTION,    // KNIGHT_PROMOTION
+    MoveClass::PROMOTION,    // BISHOP_PROMOTION
+    MoveClass::PROMOTION,    // ROOK_PROMOTION
+    MoveClass::PROMOTION,    // QUEEN_PROMOTION
+    MoveClass::PROMOTION,    // KNIGHT_PROMO_CAPTURE
+    MoveClass::PROMOTION,    // BISHOP_PROMO_CAPTURE
+    MoveClass::PROMOTION,    // ROOK_PROMO_CAPTURE
+    MoveClass::PROMOTION,    // QUEEN_PROMO_CAPTURE
+};
+
+/**
+ * @brief makes a move
+ * @param move a legal move of this position
+ * 
+ * the side to move and the class of the move are looked up once, and each combination of
+ * the two has its own version of make, so quiet moves and captures run without testing for
+ * castling, enpassant or promotion
+ */
+void Board::make_move(Move const &move)
+{
+    if (to_move == WHITE)
+        make_move<WHITE>(move);
+    else
+        make_move<BLACK>(move);
+}
+
+/**
+ * @brief undoes the last move made
+ * @param move the move that was made
+ */
+void Board::undo_move(Move const &move)
+{
+    // the previous ply still holds the placement from before the move
+    if constexpr (COPY_MAKE_BOARD)
+    {
+        restore();
+        to_move = ~to_move;
+        return;
+    }
+
+    if (to_move == WHITE)
+        undo_move<BLACK>(move);
+    else
+        undo_move<WHITE>(move);
+}
+
+template<Color us>
+void Board::make_move(Move move)
+{
+    switch (MOVE_CLASS[move.flags()])
+    {
+        case MoveClass::QUIET:       make<us, MoveClass::QUIET>(move);       break;
+        case MoveClass::CAPTURE:     make<us, MoveClass::CAPTURE>(move);     break;
+        case MoveClass::DOUBLE_PUSH: make<us, MoveClass::DOUBLE_PUSH>(move); break;
+        case MoveClass::ENPASSANT:   make<us, MoveClass::ENPASSANT>(move);   break;
+        case MoveClass::CASTLE:      make<us, MoveClass::CASTLE>(move);      break;
+        case MoveClass::PROMOTION:   make<us, MoveClass::PROMOTION>(move);   break;
+    }
+}
+
+template<Color us>
+void Board::undo_move(Move move)
+{
+    switch (MOVE_CLASS[move.flags()])
+    {
+        case MoveClass::QUIET:       unmake<us, MoveClass::QUIET>(move);       break;
+        case MoveClass::CAPTURE:     unmake<us, MoveClass::CAPTURE>(move);     break;
+        case MoveClass::DOUBLE_PUSH: unmake<us, MoveClass::DOUBLE_PUSH>(move); break;
+        case MoveClass::ENPASSANT:   unmake<us, MoveClass::ENPASSANT>(move);   break;
+        case MoveClass::CASTLE:      unmake<us, MoveClass::CASTLE>(move);      break;
+        case MoveClass::PROMOTION:   unmake<us, MoveClass::PROMOTION>(move);   break;
+    }
+}
+
+/**
+ * @brief makes a move of one class for one side
+ * @param move a legal move of this position
+ * 
+ * inlined into the switch of make_move<us>, a call for the dispatch and another for the move
+ * would cost more than the branches specialization saves
+ */
+template<Color us, MoveClass mc>
+[[gnu::always_inline]] inline void Board::make(Move move)
+{
+    constexpr Color them = us == WHITE ? BLACK : WHITE;
+
+    save();
+
+    Square from = move.from();
+    Square to   = move.to();
+    u64 from_to = (1ull << from) | (1ull << to);
+
+    BoardState &st = state();
+    u64 key        = st.key ^ Zobrist::turn();
+    Score psq      = st.psq;
+
+    // the enpassant square only lasts one move
+    if (st.ep_sq != EP_NONE)
+    {
+        key     ^= Zobrist::enpassant(static_cast<Square>(st.ep_sq));
+        st.ep_sq = EP_NONE;
+    }
+
+    if constexpr (mc == MoveClass::CASTLE)
+    {
+        int idx     = move.flags() == KINGSIDE_CASTLE ? 0 : 1;
+        Square rold = castle_squares[us][idx][0];
+        Square rnew = castle_squares[us][idx][1];
+        u64 rook_bb = (1ull << rold) | (1ull << rnew);
+
+        pos().board[from] = NONE;
+        pos().board[rold] = NONE;
+        pos().board[to]   = mailbox_entry(KING, us);
+        pos().board[rnew] = mailbox_entry(ROOK, us);
+
+        pos().piece_bb[KING] ^= from_to;
+        pos().piece_bb[ROOK] ^= rook_bb;
+        pos().color_bb[us]   ^= from_to ^ rook_bb;
+
+        key ^= Zobrist::piece(KING, us, from) ^ Zobrist::piece(KING, us, to);
+        key ^= Zobrist::piece(ROOK, us, rold) ^ Zobrist::piece(ROOK, us, rnew);
+        st.key = key;
+
+        psq -= PSQ[us][KING][from];
+        psq += PSQ[us][KING][to];
+        psq -= PSQ[us][ROOK][rold];
+        psq += PSQ[us][ROOK][rnew];
+        st.psq = psq;
+
+        update_castle_rights(from, to);
+    }
+
+    else
+    {
+        constexpr bool pawn_move = mc != MoveClass::QUIET && mc != MoveClass::CAPTURE;
+
+        PieceType moved  = pawn_move ? PAWN : piece_on(from);
+        PieceType placed = mc == MoveClass::PROMOTION ? PROMOTION_PIECE[move.flags() & 0x3] : moved;
+        PieceType captured = NONE;
+
+        if (mc == MoveClass::CAPTURE || (mc == MoveClass::PROMOTION && move.is_capture()))
+        {
+            captured    = piece_on(to);
+            st.captured = captured;
+
+            pos().piece_bb[captured] ^= to;
+            pos().color_bb[them]     ^= to;
+            key      ^= Zobrist::piece(captured, them, to);
+            psq      -= PSQ[them][captured][to];
+            st.phase -= PHASE_WEIGHT[captured];
+        }
+
+        if constexpr (mc == MoveClass::ENPASSANT)
+        {
+            auto captured_square = static_cast<Square>(us == WHITE ? to - 8 : to + 8);
+
+            pos().board[captured_square] = NONE;
+            pos().piece_bb[PAWN] ^= captured_square;
+            pos().color_bb[them] ^= captured_square;
+            key ^= Zobrist::piece(PAWN, them, captured_square);
+            psq -= PSQ[them][PAWN][captured_square];
+        }
+
+        pos().board[from] = NONE;
+        pos().board[to]   = mailbox_entry(placed, us);
+
+        if constexpr (mc == MoveClass::PROMOTION)
+        {
+            pos().piece_bb[PAWN]   ^= from;
+            pos().piece_bb[placed] ^= to;
+            st.phase += PHASE_WEIGHT[placed];
+        }
+
+        else
+        {
+            pos().piece_bb[moved] ^= from_to;
+        }
+
+        pos().color_bb[us] ^= from_to;
+        key ^= Zobrist::piece(moved, us, from) ^ Zobrist::piece(placed, us, to);
+        psq -= PSQ[us][moved][from];
+        psq += PSQ[us][placed][to];
+
+        // the square behind a double push is only an enpassant square if one of their pawns can capture on it
+        if constexpr (mc == MoveClass::DOUBLE_PUSH)
+        {
+            auto ep_sq = static_cast<Square>(us == WHITE ? to - 8 : to + 8);
+
+            if (Constants::pawn_attack_table[us][ep_sq] & pieces(PAWN, them))
+            {
+                st.ep_sq = ep_sq;
+                key     ^= Zobrist::enpassant(ep_sq);
+            }
+        }
+
+        st.key = key;
+        st.psq = psq;
+
+        // pawns never stand on the squares that castle rights depend on
+        if constexpr (mc != MoveClass::DOUBLE_PUSH && mc != MoveClass::ENPASSANT)
+            update_castle_rights(from, to);
+    }
+
+    to_move = them;
+}
+
+/**
+ * @brief undoes a move of one class for one side
+ * @param move the move that was made
+ * 
+ * inlined into the switch of undo_move<us>, like make
+ */
+template<Color us, MoveClass mc>
+[[gnu::always_inline]] inline void Board::unmake(Move move)
+{
+    constexpr Color them = us == WHITE ? BLACK : WHITE;
+
+    auto captured = static_cast<PieceType>(state().captured);
+    restore();
+
+    Square from = move.from();
+    Square to   = move.to();
+    u64 from_to = (1ull << from) | (1ull << to);
+
+    if constexpr (mc == MoveClass::CASTLE)
+    {
+        int idx     = move.flags() == KINGSIDE_CASTLE ? 0 : 1;
+        Square rold = castle_squares[us][idx][0];
+        Square rnew = castle_squares[us][idx][1];
+        u64 rook_bb = (1ull << rold) | (1ull << rnew);
+
+        pos().board[to]   = NONE;
+        pos().board[rnew] = NONE;
+        pos().board[from] = mailbox_entry(KING, us);
+        pos().board[rold] = mailbox_entry(ROOK, us);
+
+        pos().piece_bb[KING] ^= from_to;
+        pos().piece_bb[ROOK] ^= rook_bb;
+        pos().color_bb[us]   ^= from_to ^ rook_bb;
+    }
+
+    else
+    {
+        PieceType placed = piece_on(to);
+        PieceType moved  = mc == MoveClass::PROMOTION ? PAWN : placed;
+
+        pos().board[from] = mailbox_entry(moved, us);
+        pos().board[to]   = mailbox_entry(captured, them);
+
+        if constexpr (mc == MoveClass::PROMOTION)
+        {
+            pos().piece_bb[PAWN]   ^= from;
+            pos().piece_bb[placed] ^= to;
+        }
+
+        else
+        {
+            pos().piece_bb[moved] ^= from_to;
+        }
+
+        pos().color_bb[us] ^= from_to;
+
+        if (mc == MoveClass::CAPTURE || (mc == MoveClass::PROMOTION && captured != NONE))
+        {
+            pos().piece_bb[captured] ^= to;
+            pos().color_bb[them]     ^= to;
+        }
+
+        if constexpr (mc == MoveClass::ENPASSANT)
+        {
+            auto captured_square = static_cast<Square>(us == WHITE ? to - 8 : to + 8);
+
+            pos().board[captured_square] = mailbox_entry(PAWN, them);
+            pos().piece_bb[PAWN] ^= captured_square;
+            pos().color_bb[them] ^= captured_square;
+        }
+    }
+
+    to_move = us;
+}
+
 void Board::save()
 {
-    BoardState bs(castle_rights, ep_sq);
-    saved_state.push(bs);
+    if (game_ply + 1 == MAX_HISTORY) [[unlikely]]
+        forget_history();
+
+    BoardState const &prev = history[game_ply];
+
+#ifdef COPY_MAKE
+    placements[game_ply + 1] = placements[game_ply];
+#endif
+
+    game_ply++;
+
+    // the next position starts with the same irreversable state as this one
+    state().castle_rights = prev.castle_rights;
+    state().ep_sq         = prev.ep_sq;
+    state().key           = prev.key;
+    state().captured      = NONE;
+    state().phase         = prev.phase;
+    state().psq           = prev.psq;
+    invalidate_info();
 }
 
 void Board::restore()
 {
-    assert(!saved_state.empty());
-    auto state = saved_state.top();
-    castle_rights[0][0] = state.castle_rights[0][0];
-    castle_rights[0][1] = state.castle_rights[0][1];
-    castle_rights[1][0] = state.castle_rights[1][0];
-    castle_rights[1][1] = state.castle_rights[1][1];
-    ep_sq = state.ep_sq;
-    saved_state.pop();
+    assert(game_ply > 0);
+    game_ply--;
+}
+
+/**
+ * @brief makes room in a full history by dropping its older half
+ * the older positions are only needed to undo moves made long ago, while a search only undoes the
+ * moves it made itself, which are far fewer than MAX_HISTORY / 2
+ */
+void Board::forget_history()
+{
+    constexpr int keep = MAX_HISTORY / 2;
+
+    std::copy(history + game_ply + 1 - keep, history + game_ply + 1, history);
+#ifdef COPY_MAKE
+    std::copy(placements + game_ply + 1 - keep, placements + game_ply + 1, placements);
+#endif
+
+    game_ply = keep - 1;
 }
 
 std::string Board::to_string() const
@@ -454,16 +982,17 @@ std::string Board::to_string() const
         for (int file = FILE_A; file <= FILE_H; ++file)
         {
             Square s = static_cast<Square>(rank * 8 + file);
-            PieceType type = board[s];
+            PieceType type = piece_on(s);
+            bool white     = color_on(s) == WHITE;
             char c;
             switch (type)
             {
-                case PAWN:   c = color_bb[WHITE] & s ? 'P' : 'p'; break;
-                case KNIGHT: c = color_bb[WHITE] & s ? 'N' : 'n'; break;
-                case BISHOP: c = color_bb[WHITE] & s ? 'B' : 'b'; break;
-                case ROOK:   c = color_bb[WHITE] & s ? 'R' : 'r'; break;
-                case QUEEN:  c = color_bb[WHITE] & s ? 'Q' : 'q'; break;
-                case KING:   c = color_bb[WHITE] & s ? 'K' : 'k'; break;
+                case PAWN:   c = white ? 'P' : 'p'; break;
+                case KNIGHT: c = white ? 'N' : 'n'; break;
+                case BISHOP: c = white ? 'B' : 'b'; break;
+                case ROOK:   c = white ? 'R' : 'r'; break;
+                case QUEEN:  c = white ? 'Q' : 'q'; break;
+                case KING:   c = white ? 'K' : 'k'; break;
                 default:     c = '*';
             }
             res += c;
@@ -475,7 +1004,313 @@ std::string Board::to_string() const
     return res;
 }
 
-bool Board::in_check(Color c)
+bool Board::in_check(Color c) const
+{
+    if (c != mover())
+        return checkers(*this, c) != 0;
+
+    // the checkers are cheap to find on their own, the rest of info is not always needed
+    if (!state().checkers_valid)
+    {
+        state().info.checkers = checkers(*this, c);
+        state().checkers_valid = true;
+    }
+
+    return state().info.checkers != 0;
+}
+
+/**
+ * @brief checks that a move could have been generated in this position, ignoring checks and pins
+ * @param mv any move, such as one from the transposition table that may belong to another position
+ * @return true if the move is pseudo-legal, so it may be passed to is_legal and make_move
+ */
+bool Board::is_pseudo_legal(Move mv) const
+{
+    Color us     = mover();
+    Square from  = mv.from();
+    Square to    = mv.to();
+    PieceType pt = piece_on(from);
+    u64 occ      = pieces();
+
+    // we must move one of our own pieces, and may not land on another
+    if (mv.is_empty() || !(pieces(us) & from) || pieces(us) & to)
+        return false;
+
+    // the two flags between enpassant and the promotions are unused
+    if (mv.flags() > ENPASSANT && !mv.is_promotion())
+        return false;
+
+    // a capture takes an opponent's piece and any other move lands on an empty square
+    if (mv.is_capture() != static_cast<bool>(pieces(~us) & to))
+        return false;
+
+    // the king and rook must be on their squares with nothing between them
+    if (mv.is_castle())
+    {
+        CastleTypes ct = mv.flags() == KINGSIDE_CASTLE ? KINGSIDE : QUEENSIDE;
+        Square king    = us == WHITE ? E1 : E8;
+        Square rook    = castle_squares[us][ct][0];
+        Square target  = ct == KINGSIDE ? (us == WHITE ? G1 : G8) : (us == WHITE ? C1 : C8);
+
+        return pt == KING && from == king && to == target && get_castle_rights(us, ct) &&
+               !(occ & Bitboard::BETWEEN_BB[king][rook]);
+    }
+
+    if (pt == PAWN)
+    {
+        int forward    = us == WHITE ? 8 : -8;
+        int start_rank = us == WHITE ? 1 : 6;
+        int last_rank  = us == WHITE ? 7 : 0;
+
+        // a pawn promotes exactly when it reaches the last rank
+        if (mv.is_promotion() != (to / 8 == last_rank))
+            return false;
+
+        if (mv.flags() == ENPASSANT)
+            return to == get_ep_sq() && Constants::pawn_attack_table[us][from] & to;
+
+        if (mv.is_capture())
+            return Constants::pawn_attack_table[us][from] & to;
+
+        if (mv.flags() == DOUBLE_PAWN_PUSH)
+            return from / 8 == start_rank && to == from + 2 * forward && !(occ & static_cast<Square>(from + forward));
+
+        return to == from + forward;
+    }
+
+    // only pawns push two squares, capture enpassant and promote
+    if (mv.flags() != QUIET_MOVE && mv.flags() != CAPTURE)
+        return false;
+
+    switch (pt)
+    {
+        case KNIGHT: return Constants::knight_move_table[from] & to;
+        case BISHOP: return sliding_attacks<BISHOP>(from, occ) & to;
+        case ROOK:   return sliding_attacks<ROOK>(from, occ) & to;
+        case QUEEN:  return sliding_attacks<QUEEN>(from, occ) & to;
+        default:     return Constants::king_move_table[from] & to;
+    }
+}
+
+/**
+ * @brief checks that a move does not leave the king of the side to move in check
+ * @param mv a legal or pseudo-legal move of this position
+ * @return true if the move is legal
+ * 
+ * pseudo-legal generation leaves out every test that involves the opponent's attacks,
+ * so this is where castling through check and enpassant discovered checks are caught
+ */
+bool Board::is_legal(Move mv) const
+{
+    Color us    = mover();
+    Square from = mv.from();
+    Square to   = mv.to();
+    Square ksq  = king_square(us);
+    u64 occ     = pieces();
+    u64 them    = pieces(~us);
+
+    // the king may not castle out of, through, or into check
+    if (mv.is_castle())
+    {
+        auto crossed = static_cast<Square>((from + to) / 2);
+        return !(attackers_to(*this, from, occ) & them) &&
+               !(attackers_to(*this, crossed, occ) & them) &&
+               !(attackers_to(*this, to, occ) & them);
+    }
+
+    // the king may not step onto an attacked square, including one behind it on a checking slider's line
+    if (from == ksq)
+        return !(attackers_to(*this, to, occ ^ from) & them);
+
+    // enpassant takes two pieces off a line at once, which no pin can describe
+    if (mv.flags() == ENPASSANT)
+    {
+        auto captured = static_cast<Square>(us == WHITE ? to - 8 : to + 8);
+        return !(attackers_to(*this, ksq, occ ^ from ^ captured ^ to) & (them ^ captured));
+    }
+
+    // out of check, only a pinned piece leaving its line can expose the king
+    if (!in_check(us))
+    {
+        if (state().info_valid)
+            return !(state().info.pinned & from) || Bitboard::LINE_BB[ksq][from] & to;
+
+        // a piece on no line through the king cannot be pinned
+        if (!Bitboard::LINE_BB[ksq][from])
+            return true;
+    }
+
+    // otherwise the king must not be attacked by anything but a piece captured on to
+    u64 captured = 1ull << to;
+    return !(attackers_to(*this, ksq, (occ ^ from) | to) & them & ~captured);
+}
+
+/**
+ * @brief checks whether a move checks the opponent's king, without making it
+ * @param mv a legal or pseudo-legal move of this position
+ * @return true if the move gives check
+ * 
+ * a move checks directly if the moved piece lands on one of its check squares, and by discovery if
+ * it leaves the line between one of our sliders and their king. Promotions, enpassant and castling
+ * change more than the moved piece and are tested separately.
+ */
+bool Board::gives_check(Move mv) const
+{
+    PositionInfo const &pi = info();
+
+    Color us    = mover();
+    Square from = mv.from();
+    Square to   = mv.to();
+    Square ksq  = king_square(~us);
+
+    if (pi.check_squares[piece_on(from)] & to)
+        return true;
+
+    if (pi.discoverers & from && !(Bitboard::LINE_BB[ksq][from] & to))
+        return true;
+
+    // the promoted piece sees the king through the square the pawn left
+    if (mv.is_promotion())
+    {
+        u64 occ = pieces() ^ from;
+
+        switch (PROMOTION_PIECE[mv.flags() & 0x3])
+        {
+            case KNIGHT: return Constants::knight_move_table[to] & ksq;
+            case BISHOP: return sliding_attacks<BISHOP>(to, occ) & ksq;
+            case ROOK:   return sliding_attacks<ROOK>(to, occ) & ksq;
+            default:     return sliding_attacks<QUEEN>(to, occ) & ksq;
+        }
+    }
+
+    // the captured pawn may have been the only piece between one of our sliders and their king
+    if (mv.flags() == ENPASSANT)
+    {
+        auto captured = static_cast<Square>(us == WHITE ? to - 8 : to + 8);
+        u64 occ       = (pieces() ^ from ^ captured) | (1ull << to);
+
+        return (sliding_attacks<BISHOP>(ksq, occ) & (pieces(BISHOP, us) | pieces(QUEEN, us))) ||
+               (sliding_attacks<ROOK>(ksq, occ) & (pieces(ROOK, us) | pieces(QUEEN, us)));
+    }
+
+    // only the rook can give check, the king has already been tested as a discoverer
+    if (mv.is_castle())
+    {
+        int idx     = mv.flags() == KINGSIDE_CASTLE ? 0 : 1;
+        Square rold = castle_squares[us][idx][0];
+        Square rnew = castle_squares[us][idx][1];
+        u64 occ     = (pieces() ^ from ^ rold) | (1ull << to) | (1ull << rnew);
+
+        return sliding_attacks<ROOK>(rnew, occ) & ksq;
+    }
+
+    return false;
+}
+
+/**
+ * @brief static exchange evaluation, whether a move wins at least some amount of material
+ * @param mv a legal or pseudo-legal move of this position
+ * @param threshold the material the move must win, may be negative
+ * @return true if the exchange of pieces on the destination square wins at least threshold
+ * 
+ * both sides keep recapturing on the destination square with their least valuable attacker and
+ * either side may stop once continuing would lose material. Sliders behind a piece that has
+ * captured join in through the square it left. Pins are ignored.
+ * 
+ * https://www.chessprogramming.org/Static_Exchange_Evaluation
+ */
+bool Board::see(Move mv, float threshold) const
+{
+    if (mv.is_castle())
+        return 0 >= threshold;
+
+    Square from = mv.from();
+    Square to   = mv.to();
+    u64 occ     = pieces() ^ from ^ to;
+
+    // the piece left standing on the destination square, which the opponent may capture next
+    PieceType moved = piece_on(from);
+    float captured  = 0;
+
+    if (mv.flags() == ENPASSANT)
+    {
+        captured = Constants::PIECE_VALUE[PAWN];
+        occ     ^= static_cast<Square>(mover() == WHITE ? to - 8 : to + 8);
+    }
+
+    else if (mv.is_capture())
+        captured = Constants::PIECE_VALUE[piece_on(to)];
+
+    if (mv.is_promotion())
+    {
+        moved     = PROMOTION_PIECE[mv.flags() & 0x3];
+        captured += Constants::PIECE_VALUE[moved] - Constants::PIECE_VALUE[PAWN];
+    }
+
+    // how much the side that just captured is above the threshold, before it loses its piece
+    float swap = captured - threshold;
+    if (swap < 0)
+        return false;
+
+    // and after, if the opponent recaptures and the exchange stops there
+    swap = Constants::PIECE_VALUE[moved] - swap;
+    if (swap <= 0)
+        return true;
+
+    u64 bishops   = pieces(BISHOP) | pieces(QUEEN);
+    u64 rooks     = pieces(ROOK) | pieces(QUEEN);
+    u64 attackers = attackers_to(*this, to, occ);
+
+    Color stm = mover();
+
+    // whether the side to move wins the exchange if it stops now
+    bool win = true;
+
+    while (true)
+    {
+        stm = ~stm;
+
+        // pieces that have captured are off the board
+        attackers &= occ;
+
+        u64 ours = attackers & pieces(stm);
+        if (!ours)
+            break;
+
+        win = !win;
+
+        // recapture with the least valuable attacker and reveal the sliders behind it
+        u64 bb;
+        PieceType pt;
+        if      ((bb = ours & pieces(PAWN)))   pt = PAWN;
+        else if ((bb = ours & pieces(KNIGHT))) pt = KNIGHT;
+        else if ((bb = ours & pieces(BISHOP))) pt = BISHOP;
+        else if ((bb = ours & pieces(ROOK)))   pt = ROOK;
+        else if ((bb = ours & pieces(QUEEN)))  pt = QUEEN;
+
+        // the king may only recapture if nothing can take it back
+        else
+            return attackers & ~pieces(stm) ? !win : win;
+
+        swap = Constants::PIECE_VALUE[pt] - swap;
+        if (win ? swap <= 0 : swap < 0)
+            break;
+
+        occ ^= bb & -bb;
+
+        if (pt == PAWN || pt == BISHOP || pt == QUEEN)
+            attackers |= sliding_attacks<BISHOP>(to, occ) & bishops;
+
+        if (pt == ROOK || pt == QUEEN)
+            attackers |= sliding_attacks<ROOK>(to, occ) & rooks;
+    }
+
+    return win;
+}
+
+void Board::compute_info() const
 {
-    return std::popcount(checkers(c)) != 0;
+    compute_position_info(*this, state().info);
+    state().info_valid     = true;
+    state().checkers_valid = true;
 }
@@ -10,167 +10,163 @@
 
 #include "game.h"
 
+#include <bit>
+#include <cctype>
 #include <iostream>
 #include <sstream>
+#include <vector>
 
 #include "board.h"
+#include "movegen.h"
+#include "movelist.h"
 #include "util.h"
 
-void parse_uci_moves(std::string const &moves)
+/**
+ * @brief plays a list of moves in uci notation, separated by spaces
+ * @return true if every move was played, otherwise the moves before the first illegal one are played
+ */
+bool parse_uci_moves(std::string const &moves)
 {
 	std::stringstream ss(moves);
 	std::string move = "";
-	while (std::getline(ss, move, ' '))
-		parse_uci_move(move);
+	while (ss >> move)
+		if (!parse_uci_move(move))
+			return false;
+
+	return true;
 }
 
-void parse_uci_move(std::string const &move)
+/**
+ * @brief plays a move in uci notation, such as e2e4 or e7e8q
+ * @return true if the move is legal in the position on the board and was played,
+ * the board is left as it was otherwise
+ */
+bool parse_uci_move(std::string const &move)
 {
-	Square from = Util::from_algebraic(move.substr(0, 2));
-	Square to = Util::from_algebraic(move.substr(2, 2));
-
-	MoveFlags flags = QUIET_MOVE;
-
-	// check if move is capture
-	bool is_capture = board.piece_on(to) != NONE;
-
-	// check if move is promotion
-	bool is_promotion = false;
-	if (move.length() == 5)
-	{
-		is_promotion = true;
-		char promo   = move.at(4);
-		switch (promo)
-		{
-			case 'q': flags = QUEEN_PROMOTION;  break;
-			case 'k': flags = KNIGHT_PROMOTION; break;
-			case 'b': flags = BISHOP_PROMOTION; break;
-			case 'r': flags = ROOK_PROMOTION;   break;
-			default:
-				std::cerr << "Invalid promotion move: " << move << "\n";
-		}
-	}
-
-	// check if move is castle
-	if (board.piece_on(from) == KING)
-	{
-		// white kingside castle
-		if (move == "e1g1")
-			flags = KINGSIDE_CASTLE;
-		// white queenside castle
-		else if (move == "e1c1")
-			flags = QUEENSIDE_CASTLE;
-		// black kingside castle
-		else if (move == "e8g8")
-			flags = KINGSIDE_CASTLE;
-		// black queenside castle
-		else if (move == "e8c8")
-			flags = QUEENSIDE_CASTLE;
-	}
+	Movelist legal_moves;
+	generate_moves(legal_moves);
 
-	if (is_capture)
+	for (Move mv : legal_moves)
 	{
-		// capture promotion
-		if (is_promotion)
+		std::stringstream ss;
+		ss << mv;
+		if (ss.str() == move)
 		{
-			switch (flags)
-			{
-				case QUEEN_PROMOTION:  flags = QUEEN_PROMO_CAPTURE;   break;
-				case KNIGHT_PROMOTION: flags = KNIGHT_PROMO_CAPTURE; break;
-				case BISHOP_PROMOTION: flags = BISHOP_PROMO_CAPTURE; break;
-				case ROOK_PROMOTION:   flags = ROOK_PROMO_CAPTURE;     break;
-			}
-		}
-
-		// regular capture
-		else
-		{
-			flags = CAPTURE;
+			board.make_move(mv);
+			return true;
 		}
 	}
 
-	// check if move is enpassant
-	if (board.piece_on(from) == PAWN && to == board.get_ep_sq())
-		flags = ENPASSANT;
-
-	// check if move is double pawn push
-	if (board.piece_on(from) == PAWN && (to == static_cast<Square>(from + 16) || to == static_cast<Square>(from - 16)))
-		flags = DOUBLE_PAWN_PUSH;
-
-	Move mv(from, to, flags);
-	board.make_move(mv);
+	std::cerr << "Illegal move: " << move << "\n";
+	return false;
 }
 
-void load_fen(std::string const &fen)
+/**
+ * @brief sets up the board from a fen string, the halfmove clock and move number are ignored
+ * @return true if the fen describes a valid position, the board is left as it was otherwise
+ */
+bool load_fen(std::string const &fen)
 {
-	board.clear();
+	Board const saved = board;
+	auto invalid = [&](std::string const &reason)
+	{
+		std::cerr << "Invalid FEN (" << reason << "): " << fen << "\n";
+		board = saved;
+		return false;
+	};
 
 	std::stringstream ss(fen);
 	std::string section = "";
 	std::vector<std::string> sections;
-	while (std::getline(ss, section, ' '))
+	while (ss >> section)
 		sections.push_back(section);
 
+	if (sections.size() < 4)
+		return invalid("missing fields");
+
+	if (sections[1] != "w" && sections[1] != "b")
+		return invalid("side to move");
+
+	board.clear();
+
 	// section 1 - piece placement
 	int rank = 7, file = 0;
 	for (auto c : sections[0])
 	{
 		if (std::isalpha(c))
 		{
-			switch (c)
+			PieceType pt;
+			switch (std::tolower(c))
 			{
-				case 'P': board.set_piece(PAWN,   Util::square_from_rank_file(rank, file), WHITE); break;
-				case 'p': board.set_piece(PAWN,   Util::square_from_rank_file(rank, file), BLACK); break;
-				case 'N': board.set_piece(KNIGHT, Util::square_from_rank_file(rank, file), WHITE); break;
-				case 'n': board.set_piece(KNIGHT, Util::square_from_rank_file(rank, file), BLACK); break;
-				case 'B': board.set_piece(BISHOP, Util::square_from_rank_file(rank, file), WHITE); break;
-				case 'b': board.set_piece(BISHOP, Util::square_from_rank_file(rank, file), BLACK); break;
-				case 'R': board.set_piece(ROOK,   Util::square_from_rank_file(rank, file), WHITE); break;
-				case 'r': board.set_piece(ROOK,   Util::square_from_rank_file(rank, file), BLACK); break;
-				case 'Q': board.set_piece(QUEEN,  Util::square_from_rank_file(rank, file), WHITE); break;
-				case 'q': board.set_piece(QUEEN,  Util::square_from_rank_file(rank, file), BLACK); break;
-				case 'K': board.set_piece(KING,   Util::square_from_rank_file(rank, file), WHITE); break;
-				case 'k': board.set_piece(KING,   Util::square_from_rank_file(rank, file), BLACK); break;
+				case 'p': pt = PAWN;   break;
+				case 'n': pt = KNIGHT; break;
+				case 'b': pt = BISHOP; break;
+				case 'r': pt = ROOK;   break;
+				case 'q': pt = QUEEN;  break;
+				case 'k': pt = KING;   break;
 				default:
-					std::cerr << "Invalid FEN: " << sections[0] << "\n";
-					return;
+					return invalid("piece placement");
 			}
 
+			if (file > 7)
+				return invalid("piece placement");
+
+			board.set_piece(pt, Util::square_from_rank_file(rank, file), std::isupper(c) ? WHITE : BLACK);
 			file += 1;
 		}
 
-		else if (std::isdigit(c))
+		else if (c >= '1' && c <= '8')
 			file += c - '0';
 
-		else if (c == '/')
+		else if (c == '/' && file == 8 && rank > 0)
 		{
 			rank -= 1;
 			file = 0;
 		}
 
 		else
-		{
-			std::cerr << "Invalid FEN: " << sections[0] << "\n";
-			return;
-		}
+			return invalid("piece placement");
 	}
 
+	if (rank != 0 || file != 8)
+		return invalid("piece placement");
+
+	if (std::popcount(board.pieces(KING, WHITE)) != 1 || std::popcount(board.pieces(KING, BLACK)) != 1)
+		return invalid("kings");
+
 	// section 2 - side to move
 	board.set_to_move(sections[1] == "w" ? WHITE : BLACK);
 
-	// section 3 - castle rights
-	for (auto c : sections[2])
+	// section 3 - castle rights, the king and rook must still be on their squares
+	for (auto c : sections[2] == "-" ? std::string() : sections[2])
 	{
-		switch (c)
-		{
-			case 'K': board.set_castle_rights(WHITE, KINGSIDE);  break;
-			case 'Q': board.set_castle_rights(WHITE, QUEENSIDE); break;
-			case 'k': board.set_castle_rights(BLACK, KINGSIDE);  break;
-			case 'q': board.set_castle_rights(BLACK, QUEENSIDE); break;
-		}
+		if (std::tolower(c) != 'k' && std::tolower(c) != 'q')
+			return invalid("castle rights");
+
+		Color color    = std::isupper(c) ? WHITE : BLACK;
+		Square king    = color == WHITE ? E1 : E8;
+		CastleTypes ct = std::tolower(c) == 'k' ? KINGSIDE : QUEENSIDE;
+		Square rook    = ct == KINGSIDE ? (color == WHITE ? H1 : H8) : (color == WHITE ? A1 : A8);
+
+		if (!(board.pieces(KING, color) & king) || !(board.pieces(ROOK, color) & rook))
+			return invalid("castle rights");
+
+		board.set_castle_rights(color, ct);
 	}
 
-	// section 4 - en passant target square
+	// section 4 - en passant target square, on the rank the pawn that just moved two squares crossed
 	if (sections[3] != "-")
+	{
+		char ep_rank = board.mover() == WHITE ? '6' : '3';
+		if (sections[3].size() != 2 || sections[3][0] < 'a' || sections[3][0] > 'h' || sections[3][1] != ep_rank)
+			return invalid("en passant square");
+
 		board.set_ep_sq(Util::from_algebraic(sections[3]));
+	}
+
+	// the side that just moved can not have left its king in check
+	if (board.in_check(~board.mover()))
+		return invalid("side not to move is in check");
+
+	return true;
 }
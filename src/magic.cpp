@@ -0,0 +1,195 @@
+/** excalibur
+ * License: GPLv2
+ * See LICENSE for full license text
+ * Author: Sam Kravitz
+ * 
+ * FILE: magic.cpp
+ * DATE: October 17th, 2026
+ * DESCRIPTION: magic bitboard lookup of sliding piece attacks
+ */
+
+#include "magic.h"
+
+#include <bit>
+
+#if defined(__x86_64__)
+	#include <cpuid.h>
+#endif
+
+#include "bitboard.h"
+#include "movegen.h"
+
+namespace Magic
+{
+Backend backend = MAGIC;
+
+Entry bishop_magics[64];
+Entry rook_magics[64];
+
+// shared attack tables: the sum over all squares of 2^(bits in mask)
+static u64 bishop_table[0x1480];
+static u64 rook_table[0x19000];
+
+/*
+ * xorshift64* pseudo random number generator
+ * the seed is fixed so the same magics are found on every startup
+ * https://www.chessprogramming.org/Xorshift
+ */
+class PRNG
+{
+public:
+	PRNG(u64 seed) : s(seed) { }
+
+	u64 rand()
+	{
+		s ^= s >> 12;
+		s ^= s << 25;
+		s ^= s >> 27;
+		return s * 2685821657736338717ull;
+	}
+
+	// magics with few set bits are found much faster
+	u64 sparse_rand() { return rand() & rand() & rand(); }
+
+private:
+	u64 s;
+};
+
+/**
+ * @brief finds a magic multiplier for every square and fills in the shared attack table
+ * @param magics the array of entries to initialize
+ * @param table the attack table shared between all 64 squares
+ * @param attacks reference (classical) attack generator used to fill the table
+ */
+static void init_magics(Entry magics[64], u64 *table, u64 (*attacks)(Square, u64))
+{
+	// a few seeds per rank that are known to find magics quickly
+	constexpr u64 seeds[8] = { 728, 10316, 55013, 32803, 12281, 15100, 16645, 255 };
+
+	u64 occupancy[4096];
+	u64 reference[4096];
+	int epoch[4096] = { 0 };
+	int attempt     = 0;
+
+	u64 *next = table;
+
+	for (int i = 0; i < 64; i++)
+	{
+		auto square = static_cast<Square>(i);
+		Entry &e    = magics[square];
+
+		// board edges are not relevant occupancy unless the piece is on that edge
+		u64 edges = ((Bitboard::RANK_BB[RANK_1] | Bitboard::RANK_BB[RANK_8]) & ~Bitboard::RANK_BB[square / 8]) |
+		            ((Bitboard::FILE_BB[FILE_A] | Bitboard::FILE_BB[FILE_H]) & ~Bitboard::FILE_BB[square % 8]);
+
+		e.mask    = attacks(square, 0) & ~edges;
+		e.shift   = 64 - std::popcount(e.mask);
+		e.attacks = next;
+
+		// enumerate every subset of the mask with the carry-rippler trick
+		int size = 0;
+		u64 occ  = 0;
+		do
+		{
+			occupancy[size] = occ;
+			reference[size] = attacks(square, occ);
+			size++;
+			occ = (occ - e.mask) & e.mask;
+		} while (occ);
+
+		next += size;
+
+		// pext indices are dense by construction, so no magic is needed
+		if (backend == PEXT)
+		{
+			for (int j = 0; j < size; j++)
+				e.attacks[e.index(occupancy[j])] = reference[j];
+
+			continue;
+		}
+
+		PRNG rng(seeds[square / 8]);
+
+		// try random magics until every subset maps to an index without a destructive collision
+		for (int j = 0; j < size;)
+		{
+			do
+				e.magic = rng.sparse_rand();
+			while (std::popcount((e.magic * e.mask) >> 56) < 6);
+
+			attempt++;
+			for (j = 0; j < size; j++)
+			{
+				unsigned idx = e.index(occupancy[j]);
+
+				if (epoch[idx] < attempt)
+				{
+					epoch[idx]     = attempt;
+					e.attacks[idx] = reference[j];
+				}
+
+				else if (e.attacks[idx] != reference[j])
+					break;
+			}
+		}
+	}
+}
+
+static u64 classical_bishop_attacks(Square square, u64 occupied)
+{
+	return diagonal_attacks(square, occupied) | antidiagonal_attacks(square, occupied);
+}
+
+static u64 classical_rook_attacks(Square square, u64 occupied)
+{
+	return file_attacks(square, occupied) | rank_attacks(square, occupied);
+}
+
+/**
+ * @brief determines whether this CPU has a PEXT instruction that is faster than a magic multiply
+ * 
+ * AMD CPUs before Zen 3 (family 0x19) implement PEXT in microcode with a latency
+ * that depends on the mask, which is far slower than a multiply and shift
+ */
+static bool has_fast_pext()
+{
+#if defined(__x86_64__)
+	if (!__builtin_cpu_supports("bmi2"))
+		return false;
+
+	if (__builtin_cpu_is("amd"))
+	{
+		unsigned eax, ebx, ecx, edx;
+		if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+			return false;
+
+		unsigned family = (eax >> 8) & 0xf;
+		if (family == 0xf)
+			family += (eax >> 20) & 0xff;
+
+		return family >= 0x19;
+	}
+
+	return true;
+#else
+	return false;
+#endif
+}
+
+/**
+ * @brief initializes the sliding attack tables
+ * must be called once at startup before any sliding attacks are generated
+ */
+void init()
+{
+	backend = has_fast_pext() ? PEXT : MAGIC;
+
+	init_magics(bishop_magics, bishop_table, classical_bishop_attacks);
+	init_magics(rook_magics, rook_table, classical_rook_attacks);
+}
+
+const char *backend_name()
+{
+	return backend == PEXT ? "pext" : "magic";
+}
+}
@@ -8,28 +8,79 @@
  * DESCRIPTION: main()
  */
 
+#include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <memory>
+#include <thread>
 
 #include "board.h"
 #include "game.h"
+#include "magic.h"
+#include "perft.h"
 #include "search.h"
+#include "tt.h"
 #include "uci.h"
 #include "polyglot.h"
 
-// global board object
-Board board;
+/*
+ * global board object
+ * every thread has its own copy, so search threads can each make moves on a copy of the game's board
+ */
+thread_local Board board;
 
 int main(int argc, char **argv)
 {
+	Magic::init();
+	board.reset();
+
 	if (argc == 1)
 	{
+		book.open(DEFAULT_BOOK);
 		uci();
 		return 0;
 	}
 
+	// measure move generation speed on the standard perft positions, then search time to depth
+	// bench [threads]
+	if (std::string(argv[1]) == "bench")
+	{
+		int threads = argc > 2 ? atoi(argv[2]) : 1;
+		perft_bench(threads);
+		search_bench(threads);
+		return 0;
+	}
+
+	// count the nodes of a position, split across all cores unless told otherwise
+	// perft <depth> [threads] [fen] [hash megabytes]
+	if (std::string(argv[1]) == "perft" && argc > 2)
+	{
+		int depth       = atoi(argv[2]);
+		int threads     = argc > 3 ? atoi(argv[3]) : std::max<int>(std::thread::hardware_concurrency(), 1);
+		std::string fen = argc > 4 ? argv[4] : "";
+		int hash_mb     = argc > 5 ? atoi(argv[5]) : 0;
+
+		std::unique_ptr<PerftTable> table;
+		if (hash_mb > 0)
+			table = std::make_unique<PerftTable>(hash_mb);
+
+		auto start = std::chrono::steady_clock::now();
+		u64 nodes  = perft_parallel(depth, threads, fen, table.get());
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+		std::cout << "nodes " << nodes << " time " << elapsed.count() << "s nps "
+		          << static_cast<u64>(nodes / elapsed.count());
+		if (table)
+			std::cout << " hash hit rate " << table->hit_rate();
+		std::cout << "\n";
+		return 0;
+	}
+
 	// time left in the game, total game time in milliseconds
 	int time_left, game_time;
 
+	std::string book_path = DEFAULT_BOOK;
+
 	for (int i = 1; i < argc; ++i)
 	{
 		auto arg = std::string(argv[i]);
@@ -40,11 +91,25 @@ int main(int argc, char **argv)
 		else if (arg == "-t")
 			time_left = atoi(argv[++i]);
 
+		// transposition table size in megabytes
+		else if (arg == "-H")
+			tt.resize(atoi(argv[++i]));
+
+		// opening book
+		else if (arg == "-b")
+			book_path = argv[++i];
+
+		// number of search threads
+		else if (arg == "-T")
+			searcher.set_threads(atoi(argv[++i]));
+
 		else
 			parse_uci_move(std::string(arg));
 	}
 
-	auto opening_move = polyglot(board);
+	book.open(book_path);
+
+	auto opening_move = polyglot();
 	if (!opening_move.is_empty())
 	{
 		std::cout << opening_move << "\n";
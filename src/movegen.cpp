@@ -16,25 +16,140 @@
 #include "bitboard.h"
 #include "board.h"
 #include "constants.h"
+#include "magic.h"
 
 // global board object
-extern Board board;
+extern thread_local Board board;
 
-Movelist generate_moves()
+// what pseudo-legal generation sees in place of the position's checks, pins and attacks
+static const PositionInfo NO_INFO {};
+
+void generate_moves(Movelist &moves, Legality legality)
+{
+	if (legality == PSEUDO_LEGAL)
+		return board.mover() == WHITE ? movegen<WHITE, ALL, PSEUDO_LEGAL>(moves) : movegen<BLACK, ALL, PSEUDO_LEGAL>(moves);
+
+	if (board.info().checkers)
+		return generate_evasions(moves);
+
+	return board.mover() == WHITE ? movegen<WHITE, ALL>(moves) : movegen<BLACK, ALL>(moves);
+}
+
+void generate_evasions(Movelist &moves)
 {
-	return board.mover() == WHITE ? movegen<WHITE, ALL>() : movegen<BLACK, ALL>();
+	return board.mover() == WHITE ? movegen<WHITE, EVASIONS>(moves) : movegen<BLACK, EVASIONS>(moves);
 }
 
-Movelist generate_captures()
+void generate_quiet_checks(Movelist &moves)
+{
+	return board.mover() == WHITE ? movegen<WHITE, QUIET_CHECKS>(moves) : movegen<BLACK, QUIET_CHECKS>(moves);
+}
+
+void generate_captures(Movelist &moves, Legality legality)
+{
+	if (legality == PSEUDO_LEGAL)
+		return board.mover() == WHITE ? movegen<WHITE, CAPTURES, PSEUDO_LEGAL>(moves) : movegen<BLACK, CAPTURES, PSEUDO_LEGAL>(moves);
+
+	return board.mover() == WHITE ? movegen<WHITE, CAPTURES>(moves) : movegen<BLACK, CAPTURES>(moves);
+}
+
+void generate_quiets(Movelist &moves, Legality legality)
+{
+	if (legality == PSEUDO_LEGAL)
+		return board.mover() == WHITE ? movegen<WHITE, QUIETS, PSEUDO_LEGAL>(moves) : movegen<BLACK, QUIETS, PSEUDO_LEGAL>(moves);
+
+	return board.mover() == WHITE ? movegen<WHITE, QUIETS>(moves) : movegen<BLACK, QUIETS>(moves);
+}
+
+/**
+ * @brief finds whether we may castle
+ * @param ct the side to castle on
+ * @param occ occupied set of the board
+ * @param attacked squares the opponent attacks, empty for pseudo-legal generation
+ * @return true if we have the right to castle, the squares between king and rook are empty,
+ * and the king does not cross or land on an attacked square (being in check is not tested)
+ */
+template<Color c, CastleTypes ct>
+static bool can_castle(u64 occ, u64 attacked)
+{
+	constexpr Square king = c == WHITE ? E1 : E8;
+	constexpr Square rook = ct == KINGSIDE ? (c == WHITE ? H1 : H8) : (c == WHITE ? A1 : A8);
+
+	// squares the king crosses and lands on, on the queenside the rook also crosses the B file
+	constexpr Square s1 = ct == KINGSIDE ? (c == WHITE ? F1 : F8) : (c == WHITE ? D1 : D8);
+	constexpr Square s2 = ct == KINGSIDE ? (c == WHITE ? G1 : G8) : (c == WHITE ? C1 : C8);
+
+	if (!board.get_castle_rights(c, ct))
+		return false;
+
+	// castling impeded by check
+	if (attacked & s1 || attacked & s2)
+		return false;
+
+	// castling impeded by another piece anywhere between the king and the rook
+	return !(occ & Bitboard::BETWEEN_BB[king][rook]);
+}
+
+/**
+ * @brief finds our pawns that can capture enpassant
+ * @param occ occupied set of the board
+ * @param check_mask squares a move must land on or capture on to get out of check, all squares if not in check
+ * @param king_square square of our king
+ * @return set of pawns that can capture onto the enpassant square
+ */
+template<Color c, Legality legality>
+static u64 enpassant_captors(u64 occ, u64 check_mask, Square king_square)
 {
-	return board.mover() == WHITE ? movegen<WHITE, CAPTURES>() : movegen<BLACK, CAPTURES>();
+	constexpr Color opp_color = c == WHITE ? BLACK : WHITE;
+
+	const auto ep_sq = board.get_ep_sq();
+	if (ep_sq == EP_NONE)
+		return 0;
+
+	// square of the pawn being captured, which is not the square we move to
+	auto captured_sq = static_cast<Square>(c == WHITE ? ep_sq - 8 : ep_sq + 8);
+
+	// in check, the capture has to either take the checking pawn or block a slider on the enpassant square
+	if (!(check_mask & captured_sq) && !(check_mask & ep_sq))
+		return 0;
+
+	u64 attackers = Constants::pawn_attack_table[opp_color][ep_sq] & board.pieces(PAWN, c);
+	if constexpr (legality == PSEUDO_LEGAL)
+		return attackers;
+
+	u64 their_rooks   = board.pieces(ROOK, opp_color) | board.pieces(QUEEN, opp_color);
+	u64 their_bishops = board.pieces(BISHOP, opp_color) | board.pieces(QUEEN, opp_color);
+
+	u64 captors = 0;
+	while (attackers)
+	{
+		Square from = bitscan(attackers);
+
+		/*
+		 * two pawns leave their squares and one arrives on another, which can expose our king to a
+		 * slider in ways the pin detection does not see (both pawns on the king's rank, for one).
+		 * a pawn or knight check was already dealt with by the check mask, so only sliders can
+		 * still be attacking the king after the capture
+		 */
+		u64 occ_after = occ ^ from ^ captured_sq ^ ep_sq;
+
+		if (!(sliding_attacks<ROOK>(king_square, occ_after) & their_rooks) &&
+		    !(sliding_attacks<BISHOP>(king_square, occ_after) & their_bishops))
+			captors |= from;
+	}
+
+	return captors;
 }
 
-template<Color c, MovegenType type>
-Movelist movegen()
+/**
+ * @brief generates moves of one kind for one side
+ * @param moves list the moves are added to
+ */
+template<Color c, MovegenType type, Legality legality>
+void movegen(Movelist &moves)
 {
 	static_assert(c == WHITE || c == BLACK);
-	Movelist moves;
+	static_assert(legality == LEGAL || type == ALL || type == CAPTURES || type == QUIETS);
 
 	// get occupancy set (all pieces)
 	u64 occ = board.pieces();
@@ -52,31 +167,46 @@ Movelist movegen()
 	// rank on which a pawn can promote
 	constexpr u64 promotion_rank = c == WHITE ? Bitboard::RANK_BB[RANK_8] : Bitboard::RANK_BB[RANK_1];
 
-	auto const &piece_on = [&](Square to) -> bool
-	{
-		return board.piece_on(to) != NONE;
-	};
+	// squares pieces may move to: captures, quiet moves, or both
+	u64 targets = type == CAPTURES ? opponents : type == QUIETS || type == QUIET_CHECKS ? ~occ : ~our_pieces;
+
+	// captures are generated by every type but these two
+	constexpr bool captures = type != QUIETS && type != QUIET_CHECKS;
 
 	auto const &make_flags = [&](Square to) -> MoveFlags
 	{
 		return board.piece_on(to) == NONE ? QUIET_MOVE : CAPTURE;
 	};
 
-	// declare variables needed for legal move generation
-	u64 occ_without_king;                    // get occupancy set without our king (used for calculating legal moves)
-	u64 opponent_attacks;                    // opponents attack set
-	u64 checks;                              // set of squares attacking our king
-	u64 check_mask = 0xffffffffffffffff;     // set of squares we are allowed to move to due to check
-	u64 pinners;                             // set of squares on which is a piece pinning us
-	u64 pinned = 0;                          // set of squares on which we haved a pinned piece
-	u64 pinner_rays = 0xffffffffffffffff;    // set of all rays from a pinner to our king (with pinned piece remove)
-	bool in_check, in_double_check;
-
-	occ_without_king = occ ^ board.pieces(KING, c);
-	opponent_attacks = attack_set<opp_color>(board, occ_without_king);
-	checks           = checkers(c);
-	in_check         = std::popcount(checks) == 1;
-	in_double_check  = std::popcount(checks) > 1;
+	// checkers, pins and the opponent's attacks are computed once per position and shared.
+	// pseudo-legal generation does without them, leaving Board::is_legal to catch the moves they would rule out
+	auto const &info = legality == LEGAL ? board.info() : NO_INFO;
+
+	u64 opponent_attacks = info.opponent_attacks;    // opponents attack set, seeing through our king
+	u64 checks           = info.checkers;            // set of squares attacking our king
+	u64 pinned           = info.pinned;              // set of squares on which we haved a pinned piece
+	u64 check_mask       = 0xffffffffffffffff;       // set of squares we are allowed to move to due to check
+
+	bool in_check        = std::popcount(checks) == 1;
+	bool in_double_check = std::popcount(checks) > 1;
+
+	if constexpr (type == EVASIONS)
+		assert(checks);
+
+	if constexpr (type == QUIET_CHECKS)
+		assert(!checks);
+
+	Square their_king = board.king_square(opp_color);
+
+	// the squares a piece can move to and give check, either directly or by uncovering one of our sliders
+	auto const &checking_squares = [&](PieceType pt, Square from) -> u64
+	{
+		u64 squares = info.check_squares[pt];
+		if (info.discoverers & from)
+			squares |= ~Bitboard::LINE_BB[their_king][from];
+
+		return squares;
+	};
 
 	/*
     * if we are in single check, we need to calculate what squares we are allowed to move to
@@ -92,186 +222,53 @@ Movelist movegen()
     */
 	if (in_check)
 	{
-		// default our moves to only those who capture our checker
-		check_mask = checks;
-
-		Square checker_square = bitscan(checks);
-		PieceType checker_piece = board.piece_on(checker_square);
-
-		// checking piece is a sliding piece, so we can attempt to block
-		if (checker_piece == BISHOP || checker_piece == ROOK || checker_piece == QUEEN)
-		{
-			switch (Constants::dir_lookup_table[checker_square][king_square])
-			{
-				case NORTH:     check_mask |= ray_attacks<NORTH>(checker_square, occ);     break;
-				case SOUTH:     check_mask |= ray_attacks<SOUTH>(checker_square, occ);     break;
-				case EAST:      check_mask |= ray_attacks<EAST>(checker_square, occ);      break;
-				case WEST:      check_mask |= ray_attacks<WEST>(checker_square, occ);      break;
-				case NORTHEAST: check_mask |= ray_attacks<NORTHEAST>(checker_square, occ); break;
-				case NORTHWEST: check_mask |= ray_attacks<NORTHWEST>(checker_square, occ); break;
-				case SOUTHEAST: check_mask |= ray_attacks<SOUTHEAST>(checker_square, occ); break;
-				case SOUTHWEST: check_mask |= ray_attacks<SOUTHWEST>(checker_square, occ); break;
-			}
-
-			check_mask ^= king_square;
-		}
+		// capture the checker, or block it if it is a slider (nothing lies between the king and a pawn or knight)
+		Square checker_square = bitscan_cp(checks);
+		check_mask = checks | Bitboard::BETWEEN_BB[king_square][checker_square];
 	}
 
-	// calculate pinned set
-
-	// get opponent's rook/queen and bishop/queen sets
-	u64 opRQ = board.pieces(ROOK, ~c)   | board.pieces(QUEEN, ~c);
-	u64 opBQ = board.pieces(BISHOP, ~c) | board.pieces(QUEEN, ~c);
-
-	pinners  = xray_attacks<ROOK>(occ, our_pieces, king_square) & opRQ;
-	pinners |= xray_attacks<BISHOP>(occ, our_pieces, king_square) & opBQ;
-
-	// if there are pinners, calculate the pinned set
-	if (pinners)
-	{
-		u64 tmp = pinners;
-		while (tmp)
-		{
-			Square from = bitscan(tmp);
-			u64 ray;
-			switch (Constants::dir_lookup_table[from][king_square])
-			{
-				case NORTH:
-					ray = ray_attacks<NORTH>(from, occ);
-					pinned |= bitscan_cp(ray & our_pieces);
-					break;
-				case SOUTH:
-					ray = ray_attacks<SOUTH>(from, occ);
-					pinned |= bitscan_cp<REVERSE>(ray & our_pieces);
-					break;
-				case EAST:
-					ray = ray_attacks<EAST>(from, occ);
-					pinned |= bitscan_cp(ray & our_pieces);
-					break;
-				case WEST:
-					ray = ray_attacks<WEST>(from, occ);
-					pinned |= bitscan_cp<REVERSE>(ray & our_pieces);
-					break;
-				case NORTHEAST:
-					ray = ray_attacks<NORTHEAST>(from, occ);
-					pinned |= bitscan_cp(ray & our_pieces);
-					break;
-				case NORTHWEST:
-					ray = ray_attacks<NORTHWEST>(from, occ);
-					pinned |= bitscan_cp(ray & our_pieces);
-					break;
-				case SOUTHEAST:
-					ray = ray_attacks<SOUTHEAST>(from, occ);
-					pinned |= bitscan_cp<REVERSE>(ray & our_pieces);
-					break;
-				case SOUTHWEST:
-					ray = ray_attacks<SOUTHWEST>(from, occ);
-					pinned |= bitscan_cp<REVERSE>(ray & our_pieces);
-					break;
-			}
-		}
-
-		// calculate pinner rays
-		pinner_rays = 0;
-
-		// occupancy set exluded our pinned pieces
-		u64 occ_without_pinned = occ ^ pinned;
-		while (pinners)
-		{
-			Square from = bitscan(pinners);
-			pinner_rays |= from;
-			switch (Constants::dir_lookup_table[from][king_square])
-			{
-				case NORTH:     pinner_rays |= ray_attacks<NORTH>(from, occ_without_pinned);     break;
-				case SOUTH:     pinner_rays |= ray_attacks<SOUTH>(from, occ_without_pinned);     break;
-				case EAST:      pinner_rays |= ray_attacks<EAST>(from, occ_without_pinned);      break;
-				case WEST:      pinner_rays |= ray_attacks<WEST>(from, occ_without_pinned);      break;
-				case NORTHEAST: pinner_rays |= ray_attacks<NORTHEAST>(from, occ_without_pinned); break;
-				case NORTHWEST: pinner_rays |= ray_attacks<NORTHWEST>(from, occ_without_pinned); break;
-				case SOUTHEAST: pinner_rays |= ray_attacks<SOUTHEAST>(from, occ_without_pinned); break;
-				case SOUTHWEST: pinner_rays |= ray_attacks<SOUTHWEST>(from, occ_without_pinned); break;
-			}
-		}
-	}
+	/*
+	 * a pinned piece can never get us out of check, it has to stay on the line through our king and its
+	 * pinner, which only meets the line through our king and the checker on the king itself.
+	 * so in check, only unpinned pieces need to be looked at
+	 */
+	u64 movable = in_check ? ~pinned : 0xffffffffffffffff;
 
 	// generate king moves
 	u64 king = board.pieces(KING, c);
 	Square from = bitscan(king);
 	u64 moves_bb = Constants::king_move_table[from];
-	// filter out attacked squares that are occupied by one of our pieces
-	moves_bb &= ~our_pieces;
+	// filter out squares occupied by one of our pieces, and attacked squares
+	moves_bb &= targets & ~opponent_attacks;
+	if constexpr (type == QUIET_CHECKS)
+		moves_bb &= checking_squares(KING, from);
+
 	while (moves_bb)
 	{
 		Square to = bitscan(moves_bb);
-
-		if (!(opponent_attacks & to))
-		{
-			if constexpr (type == CAPTURES)
-			{
-				if (piece_on(to))
-					moves.add({ from, to, CAPTURE });
-			}
-
-			else
-				moves.add({ from, to, make_flags(to) });
-		}
+		moves.add({ from, to, make_flags(to) });
 	}
 
 	// in double check, only king moves are valid, so we can short circuit here
 	if (in_double_check)
-		return moves;
+		return;
 
 	// generate castle moves
-	if constexpr (type != CAPTURES)
+	if constexpr (type == ALL || type == QUIETS)
 	{
+		// pseudo-legal generation sees no checks or attacks, so it only tests that the path is clear
 		if (!in_check)
 		{
-			// check for kingside castle
-			if (board.get_castle_rights(c, KINGSIDE))
-			{
-				constexpr Square s1 = c == WHITE ? F1 : F8;
-				constexpr Square s2 = c == WHITE ? G1 : G8;
+			if (can_castle<c, KINGSIDE>(occ, opponent_attacks))
+				moves.add({ king_square, c == WHITE ? G1 : G8, KINGSIDE_CASTLE });
 
-				bool castling_impeded_by_check = false;
-				bool castling_impeded_by_piece = false;
-
-				// castling impeded by check
-				if (opponent_attacks & s1 || opponent_attacks & s2)
-					castling_impeded_by_check = true;
-
-				// castling impeded by another piece
-				if (occ & s1 || occ & s2)
-					castling_impeded_by_piece = true;
-
-				if (!castling_impeded_by_check && !castling_impeded_by_piece)
-					moves.add({ king_square, s2, KINGSIDE_CASTLE });
-			}
-
-			// check for queenside castle
-			if (board.get_castle_rights(c, QUEENSIDE))
-			{
-				constexpr Square s1 = c == WHITE ? D1 : D8;
-				constexpr Square s2 = c == WHITE ? C1 : C8;
-
-				bool castling_impeded_by_check = false;
-				bool castling_impeded_by_piece = false;
-
-				// castling impeded by check
-				if (opponent_attacks & s1 || opponent_attacks & s2)
-					castling_impeded_by_check = true;
-
-				// castling impeded by another piece
-				if (occ & s1 || occ & s2)
-					castling_impeded_by_piece = true;
-
-				if (!castling_impeded_by_check && !castling_impeded_by_piece)
-					moves.add({ king_square, s2, QUEENSIDE_CASTLE });
-			}
+			if (can_castle<c, QUEENSIDE>(occ, opponent_attacks))
+				moves.add({ king_square, c == WHITE ? C1 : C8, QUEENSIDE_CASTLE });
 		}
 	}
 
 	// generate pawn pushes
-	u64 pawns = board.pieces(PAWN, c);
+	u64 pawns = board.pieces(PAWN, c) & movable;
 	constexpr int perspective = c == WHITE ? -1 : 1;
 
 	// pawn pushes can never be captures
@@ -285,11 +282,32 @@ Movelist movegen()
 			Square from = static_cast<Square>(to + 8 * perspective);
 
 			// check if pawn is pinned and if it's unable to push
-			if (pinned & from && !(pinner_rays & to))
+			if (pinned & from && !(Bitboard::LINE_BB[king_square][from] & to))
 				continue;
 
+			// a promotion checks with the new piece, which may see through the square the pawn left
+			if (type == QUIET_CHECKS && promotion_rank & to)
+			{
+				bool discovered = info.discoverers & from && !(Bitboard::LINE_BB[their_king][from] & to);
+				u64 occ_after   = occ ^ from ^ to;
+
+				if (discovered || sliding_attacks<QUEEN>(to, occ_after) & their_king)
+					moves.add({ from, to, QUEEN_PROMOTION });
+				if (discovered || sliding_attacks<BISHOP>(to, occ_after) & their_king)
+					moves.add({ from, to, BISHOP_PROMOTION });
+				if (discovered || sliding_attacks<ROOK>(to, occ_after) & their_king)
+					moves.add({ from, to, ROOK_PROMOTION });
+				if (discovered || Constants::knight_move_table[to] & their_king)
+					moves.add({ from, to, KNIGHT_PROMOTION });
+			}
+
+			else if (type == QUIET_CHECKS && !(checking_squares(PAWN, from) & to))
+			{
+				continue;
+			}
+
 			// single push is a promotion
-			if (promotion_rank & to)
+			else if (promotion_rank & to)
 			{
 				moves.add({ from, to, QUEEN_PROMOTION });
 				moves.add({ from, to, BISHOP_PROMOTION });
@@ -311,7 +329,10 @@ Movelist movegen()
 			Square from = static_cast<Square>(to + 16 * perspective);
 
 			// check if pawn is pinned and if it's unable to push
-			if (pinned & from && !(pinner_rays & to))
+			if (pinned & from && !(Bitboard::LINE_BB[king_square][from] & to))
+				continue;
+
+			if (type == QUIET_CHECKS && !(checking_squares(PAWN, from) & to))
 				continue;
 
 			moves.add({ from, to, DOUBLE_PAWN_PUSH });
@@ -319,7 +340,7 @@ Movelist movegen()
 	}
 
 	// generate pawn captures
-	while (pawns)
+	while (captures && pawns)
 	{
 		Square from = bitscan(pawns);
 		u64 attacks = Constants::pawn_attack_table[c][from] & opponents;
@@ -329,7 +350,7 @@ Movelist movegen()
 			Square to = bitscan(attacks);
 
 			// check if pawn is pinned and if it's unable to attack
-			if (pinned & from && !(pinner_rays & to))
+			if (pinned & from && !(Bitboard::LINE_BB[king_square][from] & to))
 				continue;
 
 			// capture is a promotion
@@ -349,56 +370,38 @@ Movelist movegen()
 	}
 
 	// generate enpassant moves
-	const auto ep_sq = board.get_ep_sq();
-	if (ep_sq != EP_NONE)
+	if constexpr (captures)
 	{
-		u64 pawns = board.pieces(PAWN, c);
-		while (pawns)
-		{
-			Square from = bitscan(pawns);
-			u64 ep_attacks = Constants::pawn_attack_table[c][from];
-			ep_attacks &= check_mask;
-			while (ep_attacks)
-			{
-				Square to = bitscan(ep_attacks);
-
-				// check if pawn is pinned and if it's unable to attack
-				if (pinned & from && !(pinner_rays & to))
-					continue;
-
-				// the pawn can capture enpassant
-				if (to == ep_sq)
-				{
-					/*
-                     * the last thing we have to check for is that doing the enpassant capture
-                     * does not inadvertently cause a discovered check.
-                     * 
-                     * we will do this by removing both pawns from the board and seeing if our king is in check.
-                     */
-
-					// square that we are capturing on
-					auto captured_sq =
-					    board.mover() == WHITE ? static_cast<Square>(to - 8) : static_cast<Square>(to + 8);
-
-					// pawn doing the capture
-					auto mover = board.piece_on(from);
-
-					// pawn being captured
-					auto captured = board.piece_on(captured_sq);
+		u64 captors = enpassant_captors<c, legality>(occ, check_mask, king_square);
+		while (captors)
+			moves.add({ bitscan(captors), board.get_ep_sq(), ENPASSANT });
+	}
 
-					// sanity check that both pieces are pawns
-					assert(mover == PAWN || captured == PAWN);
+	/*
+	 * out of check, only the checker's square and the squares between it and our king are worth moving to.
+	 * there are never more than seven of them, so rather than generate every piece's moves and throw most
+	 * away, look up which of our knights and sliders reach each of those squares
+	 */
+	if constexpr (type == EVASIONS)
+	{
+		u64 our_knights = board.pieces(KNIGHT, c) & movable;
+		u64 our_bishops = (board.pieces(BISHOP, c) | board.pieces(QUEEN, c)) & movable;
+		u64 our_rooks   = (board.pieces(ROOK, c) | board.pieces(QUEEN, c)) & movable;
 
-					// occupied set without either pawns
-					u64 occ_without_pawns = occ ^ from ^ captured_sq;
+		u64 evasion_squares = check_mask;
+		while (evasion_squares)
+		{
+			Square to = bitscan(evasion_squares);
 
-					u64 opponent_attacks = attack_set<opp_color>(board, occ_without_pawns);
+			u64 froms = (Constants::knight_move_table[to] & our_knights) |
+			            (sliding_attacks<BISHOP>(to, occ) & our_bishops) |
+			            (sliding_attacks<ROOK>(to, occ) & our_rooks);
 
-					if (!(opponent_attacks & king_square))
-						moves.add({ from, ep_sq, ENPASSANT });
-				}
-			}
+			while (froms)
+				moves.add({ bitscan(froms), to, make_flags(to) });
 		}
+
+		return;
 	}
 
 	// generate knight moves
@@ -412,111 +415,203 @@ Movelist movegen()
 		Square from = bitscan(knights);
 		u64 moves_bb = Constants::knight_move_table[from];
 		// filter out attacked squares that are occupied by one of our pieces
-		moves_bb &= ~our_pieces;
+		moves_bb &= targets;
 		// filter out moves not allowed because of check
 		moves_bb &= check_mask;
+		if constexpr (type == QUIET_CHECKS)
+			moves_bb &= checking_squares(KNIGHT, from);
+
 		while (moves_bb)
 		{
 			Square to = bitscan(moves_bb);
-			if constexpr (type == CAPTURES)
-			{
-				if (piece_on(to))
-					moves.add({ from, to, CAPTURE });
-			}
-
-			else
-				moves.add({ from, to, make_flags(to) });
+			moves.add({ from, to, make_flags(to) });
 		}
 	}
 
 	// generate rook moves
-	u64 rooks = board.pieces(ROOK, c);
+	u64 rooks = board.pieces(ROOK, c) & movable;
 	while (rooks)
 	{
 		Square from = bitscan(rooks);
 		u64 attacks = sliding_attacks<ROOK>(from, occ);
 
 		// filter out attacked squares that are occupied by one of our pieces
-		attacks &= ~our_pieces;
+		attacks &= targets;
 		// filter out moves not allowed because of check
 		attacks &= check_mask;
+		if constexpr (type == QUIET_CHECKS)
+			attacks &= checking_squares(ROOK, from);
 
+		// a pinned piece may only move along the line through it and our king
 		if (pinned & from)
-			attacks &= pinner_rays;
+			attacks &= Bitboard::LINE_BB[king_square][from];
 
 		while (attacks)
 		{
 			Square to = bitscan(attacks);
-			if constexpr (type == CAPTURES)
-			{
-				if (piece_on(to))
-					moves.add({ from, to, CAPTURE });
-			}
-
-			else
-				moves.add({ from, to, make_flags(to) });
+			moves.add({ from, to, make_flags(to) });
 		}
 	}
 
 	// generate bishop moves
-	u64 bishops = board.pieces(BISHOP, c);
+	u64 bishops = board.pieces(BISHOP, c) & movable;
 	while (bishops)
 	{
 		Square from = bitscan(bishops);
 		u64 attacks = sliding_attacks<BISHOP>(from, occ);
 
 		// filter out attacked squares that are occupied by one of our pieces
-		attacks &= ~our_pieces;
+		attacks &= targets;
 		// filter out moves not allowed because of check
 		attacks &= check_mask;
+		if constexpr (type == QUIET_CHECKS)
+			attacks &= checking_squares(BISHOP, from);
 
+		// a pinned piece may only move along the line through it and our king
 		if (pinned & from)
-			attacks &= pinner_rays;
+			attacks &= Bitboard::LINE_BB[king_square][from];
 
 		while (attacks)
 		{
 			Square to = bitscan(attacks);
-			if constexpr (type == CAPTURES)
-			{
-				if (piece_on(to))
-					moves.add({ from, to, CAPTURE });
-			}
-
-			else
-				moves.add({ from, to, make_flags(to) });
+			moves.add({ from, to, make_flags(to) });
 		}
 	}
 
 	// generate queen moves
-	u64 queens = board.pieces(QUEEN, c);
+	u64 queens = board.pieces(QUEEN, c) & movable;
 	while (queens)
 	{
 		Square from = bitscan(queens);
 		u64 attacks = sliding_attacks<QUEEN>(from, occ);
 
 		// filter out attacked squares that are occupied by one of our pieces
-		attacks &= ~our_pieces;
+		attacks &= targets;
 		// filter out moves not allowed because of check
 		attacks &= check_mask;
+		if constexpr (type == QUIET_CHECKS)
+			attacks &= checking_squares(QUEEN, from);
 
+		// a pinned piece may only move along the line through it and our king
 		if (pinned & from)
-			attacks &= pinner_rays;
+			attacks &= Bitboard::LINE_BB[king_square][from];
 
 		while (attacks)
 		{
 			Square to = bitscan(attacks);
-			if constexpr (type == CAPTURES)
-			{
-				if (piece_on(to))
-					moves.add({ from, to, CAPTURE });
-			}
-
-			else
-				moves.add({ from, to, make_flags(to) });
+			moves.add({ from, to, make_flags(to) });
 		}
 	}
+}
+
+/**
+ * @brief counts the legal moves of the side to move without generating them
+ * @return number of legal moves
+ * 
+ * the rules are the same as movegen<c, ALL>, but applied to whole target sets at once: the number
+ * of moves into a set is its popcount, and a pawn move onto the last rank counts four times, once
+ * for each promotion. no move is ever written, which is all perft needs at its leaves
+ */
+template<Color c>
+static u64 count_moves()
+{
+	constexpr Color opp_color    = c == WHITE ? BLACK : WHITE;
+	constexpr u64 promotion_rank = c == WHITE ? Bitboard::RANK_BB[RANK_8] : Bitboard::RANK_BB[RANK_1];
+	constexpr Direction left     = c == WHITE ? NORTHWEST : SOUTHWEST;
+	constexpr Direction right    = c == WHITE ? NORTHEAST : SOUTHEAST;
+
+	auto const &info = board.info();
+
+	u64 occ            = board.pieces();
+	u64 targets        = ~board.pieces(c);
+	Square king_square = board.king_square(c);
+
+	u64 count = std::popcount(Constants::king_move_table[king_square] & targets & ~info.opponent_attacks);
+
+	if (std::popcount(info.checkers) > 1)
+		return count;
+
+	u64 check_mask = 0xffffffffffffffff;
+
+	// a pinned piece never helps out of check, out of check it moves along its pin
+	u64 movable = info.checkers ? ~info.pinned : 0xffffffffffffffff;
+
+	if (info.checkers)
+	{
+		check_mask = info.checkers | Bitboard::BETWEEN_BB[king_square][bitscan_cp(info.checkers)];
+	}
+
+	else
+	{
+		count += can_castle<c, KINGSIDE>(occ, info.opponent_attacks);
+		count += can_castle<c, QUEENSIDE>(occ, info.opponent_attacks);
+	}
+
+	// moves onto the last rank are promotions, four moves each
+	auto const &pawn_moves = [&](u64 to) -> u64
+	{
+		return std::popcount(to & ~promotion_rank) + 4 * std::popcount(to & promotion_rank);
+	};
+
+	u64 opponents = board.pieces(opp_color);
+	u64 pawns     = board.pieces(PAWN, c);
+	u64 free      = pawns & ~info.pinned;
+
+	// unpinned pawns, all at once
+	count += pawn_moves(single_push_targets<c>(free, ~occ) & check_mask);
+	count += std::popcount(double_push_targets<c>(free, ~occ) & check_mask);
+	count += pawn_moves(shift<left>(free & ~Bitboard::FILE_BB[FILE_A]) & opponents & check_mask);
+	count += pawn_moves(shift<right>(free & ~Bitboard::FILE_BB[FILE_H]) & opponents & check_mask);
+
+	// pinned pawns, one at a time along their pin
+	u64 pinned_pawns = pawns & info.pinned & movable;
+	while (pinned_pawns)
+	{
+		Square from = bitscan(pinned_pawns);
+		u64 line    = Bitboard::LINE_BB[king_square][from];
+		u64 pawn    = 1ull << from;
+
+		count += pawn_moves(single_push_targets<c>(pawn, ~occ) & line);
+		count += std::popcount(double_push_targets<c>(pawn, ~occ) & line);
+		count += pawn_moves(Constants::pawn_attack_table[c][from] & opponents & line);
+	}
 
-	return moves;
+	count += std::popcount(enpassant_captors<c, LEGAL>(occ, check_mask, king_square));
+
+	u64 knights = board.pieces(KNIGHT, c) & ~info.pinned;
+	while (knights)
+		count += std::popcount(Constants::knight_move_table[bitscan(knights)] & targets & check_mask);
+
+	u64 bishops = (board.pieces(BISHOP, c) | board.pieces(QUEEN, c)) & movable;
+	while (bishops)
+	{
+		Square from = bitscan(bishops);
+		u64 attacks = sliding_attacks<BISHOP>(from, occ) & targets & check_mask;
+
+		if (info.pinned & from)
+			attacks &= Bitboard::LINE_BB[king_square][from];
+
+		count += std::popcount(attacks);
+	}
+
+	u64 rooks = (board.pieces(ROOK, c) | board.pieces(QUEEN, c)) & movable;
+	while (rooks)
+	{
+		Square from = bitscan(rooks);
+		u64 attacks = sliding_attacks<ROOK>(from, occ) & targets & check_mask;
+
+		if (info.pinned & from)
+			attacks &= Bitboard::LINE_BB[king_square][from];
+
+		count += std::popcount(attacks);
+	}
+
+	return count;
+}
+
+u64 count_moves()
+{
+	return board.mover() == WHITE ? count_moves<WHITE>() : count_moves<BLACK>();
 }
 
 template<PieceType pt> u64 sliding_attacks(Square square, u64 occupied)
@@ -524,14 +619,18 @@ template<PieceType pt> u64 sliding_attacks(Square square, u64 occupied)
 	static_assert(pt != PAWN && pt != KNIGHT && pt != KING, "can only use attacks() for sliding pieces!");
 
 	if constexpr (pt == BISHOP)
-		return diagonal_attacks(square, occupied) | antidiagonal_attacks(square, occupied);
+		return Magic::bishop_attacks(square, occupied);
 	else if constexpr (pt == ROOK)
-		return file_attacks(square, occupied) | rank_attacks(square, occupied);
+		return Magic::rook_attacks(square, occupied);
 	else
-		return diagonal_attacks(square, occupied) | antidiagonal_attacks(square, occupied) |
-		       file_attacks(square, occupied) | rank_attacks(square, occupied);
+		return Magic::bishop_attacks(square, occupied) | Magic::rook_attacks(square, occupied);
 }
 
+// also used outside this file
+template u64 sliding_attacks<BISHOP>(Square, u64);
+template u64 sliding_attacks<ROOK>(Square, u64);
+template u64 sliding_attacks<QUEEN>(Square, u64);
+
 template<Direction d> u64 ray_attacks(Square square, u64 occupied)
 {
 	u64 attacks = Constants::ray_attack_table[d][square];
@@ -667,10 +766,11 @@ static u64 attack_set(u64 piece_set, u64 occupied)
 
 /**
  * @brief calculates the set of all attackers to a color's king
+ * @param board the position
  * @param c the color of the king we are checking
  * @return the set of all squares attacking c's king
  */
-u64 checkers(Color c)
+u64 checkers(Board const &board, Color c)
 {
 	u64 attackers = 0;
 
@@ -686,3 +786,94 @@ u64 checkers(Color c)
 	attackers |= sliding_attacks<QUEEN>(king_square, occ) & board.pieces(QUEEN, ~c);
 	return attackers;
 }
+
+/**
+ * @brief calculates the set of all pieces of either color attacking a square
+ * @param board the position
+ * @param square the square being attacked
+ * @param occ occupied set to use for sliding attacks, pieces removed from it can be seen through
+ * @return the set of all squares with a piece attacking square
+ */
+u64 attackers_to(Board const &board, Square square, u64 occ)
+{
+	u64 bishops = board.pieces(BISHOP) | board.pieces(QUEEN);
+	u64 rooks   = board.pieces(ROOK) | board.pieces(QUEEN);
+
+	return (Constants::pawn_attack_table[WHITE][square] & board.pieces(PAWN, BLACK)) |
+	       (Constants::pawn_attack_table[BLACK][square] & board.pieces(PAWN, WHITE)) |
+	       (Constants::knight_move_table[square] & board.pieces(KNIGHT)) |
+	       (Constants::king_move_table[square] & board.pieces(KING)) |
+	       (sliding_attacks<BISHOP>(square, occ) & bishops) |
+	       (sliding_attacks<ROOK>(square, occ) & rooks);
+}
+
+/**
+ * @brief computes the checkers, pins, opponent attacks and check squares of a position
+ * @param board the position, info is for the side to move
+ * @param info set to the computed information
+ */
+template<Color c>
+static void compute_position_info(Board const &board, PositionInfo &info)
+{
+	constexpr Color opp_color = c == WHITE ? BLACK : WHITE;
+
+	u64 occ            = board.pieces();
+	u64 our_pieces     = board.pieces(c);
+	Square king_square = board.king_square(c);
+
+	// the king does not block attacks on the squares behind it, or it could step back along a checking ray
+	info.opponent_attacks = attack_set<opp_color>(board, occ ^ board.pieces(KING, c));
+
+	info.checkers  = Constants::pawn_attack_table[c][king_square] & board.pieces(PAWN, opp_color);
+	info.checkers |= Constants::knight_move_table[king_square] & board.pieces(KNIGHT, opp_color);
+	info.checkers |= sliding_attacks<BISHOP>(king_square, occ) & (board.pieces(BISHOP, opp_color) | board.pieces(QUEEN, opp_color));
+	info.checkers |= sliding_attacks<ROOK>(king_square, occ) & (board.pieces(ROOK, opp_color) | board.pieces(QUEEN, opp_color));
+
+	info.pinned = 0;
+
+	// get opponent's rook/queen and bishop/queen sets
+	u64 opRQ = board.pieces(ROOK, ~c)   | board.pieces(QUEEN, ~c);
+	u64 opBQ = board.pieces(BISHOP, ~c) | board.pieces(QUEEN, ~c);
+
+	// sliders that see our king through exactly one of our pieces
+	u64 pinners  = xray_attacks<ROOK>(occ, our_pieces, king_square) & opRQ;
+	pinners     |= xray_attacks<BISHOP>(occ, our_pieces, king_square) & opBQ;
+
+	while (pinners)
+	{
+		Square from = bitscan(pinners);
+		info.pinned |= Bitboard::BETWEEN_BB[king_square][from] & our_pieces;
+	}
+
+	// squares our pieces would give check from
+	Square their_king = board.king_square(opp_color);
+
+	// our pieces standing between one of our sliders and their king, moving one off that line gives check
+	u64 ourRQ = board.pieces(ROOK, c)   | board.pieces(QUEEN, c);
+	u64 ourBQ = board.pieces(BISHOP, c) | board.pieces(QUEEN, c);
+
+	u64 discoverers  = xray_attacks<ROOK>(occ, our_pieces, their_king) & ourRQ;
+	discoverers     |= xray_attacks<BISHOP>(occ, our_pieces, their_king) & ourBQ;
+
+	info.discoverers = 0;
+	while (discoverers)
+	{
+		Square from = bitscan(discoverers);
+		info.discoverers |= Bitboard::BETWEEN_BB[their_king][from] & our_pieces;
+	}
+
+	info.check_squares[PAWN]   = Constants::pawn_attack_table[opp_color][their_king];
+	info.check_squares[KNIGHT] = Constants::knight_move_table[their_king];
+	info.check_squares[BISHOP] = sliding_attacks<BISHOP>(their_king, occ);
+	info.check_squares[ROOK]   = sliding_attacks<ROOK>(their_king, occ);
+	info.check_squares[QUEEN]  = info.check_squares[BISHOP] | info.check_squares[ROOK];
+	info.check_squares[KING]   = 0;
+}
+
+void compute_position_info(Board const &board, PositionInfo &info)
+{
+	if (board.mover() == WHITE)
+		compute_position_info<WHITE>(board, info);
+	else
+		compute_position_info<BLACK>(board, info);
+}
@@ -11,9 +11,10 @@
 #include "movelist.h"
 
 class Board;
-extern Board board;
+extern thread_local Board board;
 
 #include <algorithm>
+#include <utility>
 
 int score(Move const &mv, Board const &board)
 {
@@ -21,32 +22,59 @@ int score(Move const &mv, Board const &board)
 	auto piece_type = board.piece_on(mv.from());
 	auto capture_piece_type = board.piece_on(mv.to());
 
-	if (piece_type != NONE)
+	// most valuable victim, least valuable attacker
+	if (piece_type != NONE && capture_piece_type != NONE)
 		guess = 10 * Constants::PIECE_VALUE[capture_piece_type] - Constants::PIECE_VALUE[piece_type];
 
 	if (mv.is_promotion())
 		guess += Constants::PIECE_VALUE[QUEEN];
 
-	auto opponent = ~board.mover();
-	if (Constants::pawn_attack_table[opponent][mv.to()] & board.pieces(PAWN, opponent))
+	// moving to a square where the piece is lost for less than it is worth
+	if (piece_type != NONE && !board.see(mv, 0))
 		guess -= Constants::PIECE_VALUE[piece_type];
 
 	return guess;
 }
 
+thread_local ScoredMove Movelist::stack[MOVE_STACK_SIZE];
+thread_local Movelist *Movelist::innermost = nullptr;
+
+/**
+ * @brief starts an empty list on top of the calling thread's move stack
+ */
 Movelist::Movelist()
 {
-	m_size = 0;
+	first     = innermost ? innermost->last : stack;
+	last      = first;
+	parent    = innermost;
+	innermost = this;
 }
 
-void Movelist::add(Move mv)
+Movelist::~Movelist()
 {
-	movelist[m_size++] = mv;
+	assert(innermost == this);
+	innermost = parent;
 }
 
+/**
+ * @brief sorts the moves best first
+ * each move is scored once up front rather than on every comparison
+ */
 void Movelist::order()
 {
-	std::sort(movelist.begin(),
-	          movelist.begin() + size(),
-	          [](Move const &lhs, Move const &rhs) { return score(lhs, board) < score(rhs, board); });
+	for (auto &sm : *this)
+		sm.score = score(sm.move, board);
+
+	std::stable_sort(begin(), end(), [](auto const &lhs, auto const &rhs) { return lhs.score > rhs.score; });
+}
+
+/**
+ * @brief moves a move to the front of the list so it is searched first, keeping the order of the rest
+ * @param mv the move to search first, nothing happens if it is not in the list
+ */
+void Movelist::move_to_front(Move mv)
+{
+	auto it = std::find_if(begin(), end(), [&](auto const &sm) { return sm.move == mv; });
+	if (it != end())
+		std::rotate(begin(), it, it + 1);
 }
@@ -0,0 +1,367 @@
+/** excalibur
+ * License: GPLv2
+ * See LICENSE for full license text
+ * Author: Sam Kravitz
+ * 
+ * FILE: movepick.cpp
+ * DATE: October 17th, 2026
+ * DESCRIPTION: hands out the moves of a position one at a time, best first
+ */
+
+#include "movepick.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "constants.h"
+
+// quiet queen promotions are searched before every other quiet move
+constexpr int QUEEN_PROMOTION_BONUS = 1 << 24;
+
+// out of check, capturing the checker is tried before every quiet evasion, history scores stay below 1 << 24
+constexpr int CAPTURE_BONUS = 1 << 25;
+
+/**
+ * @brief checks that a hash move can be played in the position on the board
+ * the hash move comes from a position with the same full 64 bit key, so it is all but
+ * certainly legal, but a key collision must not corrupt the board
+ */
+static bool plausible(Move mv)
+{
+	return board.is_pseudo_legal(mv) && board.is_legal(mv);
+}
+
+/**
+ * @brief picks moves for the main search
+ * @param hash_mv best move from the transposition table, may be empty
+ * @param killer_moves the two killer moves of this ply, quiet moves that caused a cutoff in a sibling
+ * @param history_table history scores of quiet moves
+ */
+MovePicker::MovePicker(Move hash_mv, Move const *killer_moves, HistoryTable const &history_table)
+{
+	evading      = board.in_check(board.mover());
+	stage        = evading ? EVASION_HASH_MOVE : HASH_MOVE;
+	hash_move    = plausible(hash_mv) ? hash_mv : Move();
+	killers[0]   = killer_moves[0];
+	killers[1]   = killer_moves[1];
+	killer_index = 0;
+	history      = &history_table;
+	with_checks  = false;
+	cur          = 0;
+	end          = 0;
+	losing_begin = 0;
+	losing_end   = 0;
+}
+
+/**
+ * @brief picks captures for the quiescence search, or every evasion if the side to move is in check
+ * @param hash_mv best move from the transposition table, only used if it is a capture or we are in check
+ * @param checks whether to follow the captures with quiet moves that give check
+ */
+MovePicker::MovePicker(Move hash_mv, bool checks)
+{
+	evading      = board.in_check(board.mover());
+	bool capture = hash_mv.is_capture() || hash_mv.flags() == ENPASSANT;
+
+	stage        = evading ? EVASION_HASH_MOVE : QS_HASH_MOVE;
+	hash_move    = (capture || evading) && plausible(hash_mv) ? hash_mv : Move();
+	killer_index = 0;
+	history      = nullptr;
+	with_checks  = checks;
+	cur          = 0;
+	end          = 0;
+	losing_begin = 0;
+	losing_end   = 0;
+}
+
+/**
+ * @brief the next move to search
+ * @return the next legal move, or an empty move once every move has been handed out
+ */
+Move MovePicker::next()
+{
+	Move mv = pick();
+
+	// the hash move was tested up front, evasions and quiet checks are generated legal
+	if constexpr (PICKER_LEGALITY == PSEUDO_LEGAL)
+	{
+		while (!evading && stage != QS_CHECKS && !mv.is_empty() && mv != hash_move && !board.is_legal(mv))
+			mv = pick();
+	}
+
+	return mv;
+}
+
+/**
+ * @brief the next move of the current stage, moving on to the next stage once it runs out
+ * @return the next move, which may be pseudo-legal, or an empty move once every move has been handed out
+ */
+Move MovePicker::pick()
+{
+	switch (stage)
+	{
+		case HASH_MOVE:
+			stage = GENERATE_CAPTURES;
+			if (!hash_move.is_empty())
+				return hash_move;
+			[[fallthrough]];
+
+		case GENERATE_CAPTURES:
+			add_captures(true);
+			stage = WINNING_CAPTURES;
+			[[fallthrough]];
+
+		case WINNING_CAPTURES:
+			if (cur < end)
+				return select();
+
+			// killers are only played if they are legal here, so the quiets are needed first
+			add_quiets();
+			stage = KILLERS;
+			[[fallthrough]];
+
+		case KILLERS:
+			while (killer_index < 2)
+			{
+				Move killer = killers[killer_index++];
+				if (!killer.is_empty() && killer != hash_move && take(killer))
+					return killer;
+			}
+
+			stage = QUIETS;
+			[[fallthrough]];
+
+		case QUIETS:
+			if (cur < end)
+				return select();
+
+			cur   = losing_begin;
+			end   = losing_end;
+			stage = LOSING_CAPTURES;
+			[[fallthrough]];
+
+		case LOSING_CAPTURES:
+			if (cur < end)
+				return select();
+
+			stage = DONE;
+			break;
+
+		case EVASION_HASH_MOVE:
+			stage = GENERATE_EVASIONS;
+			if (!hash_move.is_empty())
+				return hash_move;
+			[[fallthrough]];
+
+		case GENERATE_EVASIONS:
+			add_evasions();
+			stage = EVASIONS;
+			[[fallthrough]];
+
+		case EVASIONS:
+			if (cur < end)
+				return select();
+
+			stage = DONE;
+			break;
+
+		case QS_HASH_MOVE:
+			stage = QS_GENERATE_CAPTURES;
+			if (!hash_move.is_empty())
+				return hash_move;
+			[[fallthrough]];
+
+		case QS_GENERATE_CAPTURES:
+			add_captures(false);
+			stage = QS_CAPTURES;
+			[[fallthrough]];
+
+		case QS_CAPTURES:
+			if (cur < end)
+				return select();
+
+			if (!with_checks)
+			{
+				stage = DONE;
+				break;
+			}
+
+			stage = QS_GENERATE_CHECKS;
+			[[fallthrough]];
+
+		case QS_GENERATE_CHECKS:
+			add_quiet_checks();
+			stage = QS_CHECKS;
+			[[fallthrough]];
+
+		case QS_CHECKS:
+			if (cur < end)
+				return moves[cur++].move;
+
+			stage = DONE;
+			break;
+
+		case DONE:
+			break;
+	}
+
+	return Move();
+}
+
+/**
+ * @brief takes the hash move out of the moves just generated, it has been handed out already
+ * @param begin index of the first move just generated
+ */
+void MovePicker::generated(std::size_t begin)
+{
+	for (auto it = moves.begin() + begin; it != moves.end(); ++it)
+	{
+		if (it->move == hash_move)
+		{
+			moves.remove(it);
+			break;
+		}
+	}
+}
+
+/**
+ * @brief most valuable victim, least valuable attacker score of a capture, counting a promotion's gain
+ */
+static float capture_gain(Move mv)
+{
+	PieceType victim = mv.flags() == ENPASSANT ? PAWN : board.piece_on(mv.to());
+
+	float gain = Constants::PIECE_VALUE[victim];
+	if (mv.is_promotion())
+		gain += Constants::PIECE_VALUE[PROMOTION_PIECE[mv.flags() & 0x3]];
+
+	return gain;
+}
+
+static int capture_score(Move mv)
+{
+	return static_cast<int>(10 * capture_gain(mv) - Constants::PIECE_VALUE[board.piece_on(mv.from())]);
+}
+
+/**
+ * @brief generates and scores the captures, most valuable victim first and then least valuable attacker
+ * @param split_losing whether to set apart the captures that lose material by static exchange evaluation
+ */
+void MovePicker::add_captures(bool split_losing)
+{
+	std::size_t begin = moves.size();
+	generate_captures(moves, PICKER_LEGALITY);
+	generated(begin);
+
+	for (auto it = moves.begin() + begin; it != moves.end(); ++it)
+		it->score = capture_score(it->move);
+
+	auto winning = [](ScoredMove const &sm) { return board.see(sm.move, 0); };
+	auto split   = split_losing ? std::partition(moves.begin() + begin, moves.end(), winning) : moves.end();
+
+	cur          = begin;
+	end          = split - moves.begin();
+	losing_begin = end;
+	losing_end   = moves.size();
+}
+
+/**
+ * @brief generates the quiet moves and scores them by history
+ */
+void MovePicker::add_quiets()
+{
+	Color us = board.mover();
+
+	std::size_t begin = moves.size();
+	generate_quiets(moves, PICKER_LEGALITY);
+	generated(begin);
+
+	for (auto it = moves.begin() + begin; it != moves.end(); ++it)
+	{
+		it->score = (*history)[us][it->move.from()][it->move.to()];
+
+		if (it->move.flags() == QUEEN_PROMOTION)
+			it->score += QUEEN_PROMOTION_BONUS;
+	}
+
+	cur = begin;
+	end = moves.size();
+}
+
+/**
+ * @brief generates the moves out of check, captures first by MVV-LVA and then quiet moves by history
+ * there are few enough evasions that they are all generated at once and not split into stages
+ */
+void MovePicker::add_evasions()
+{
+	Color us = board.mover();
+
+	std::size_t begin = moves.size();
+	generate_evasions(moves);
+	generated(begin);
+
+	for (auto it = moves.begin() + begin; it != moves.end(); ++it)
+	{
+		Move mv = it->move;
+
+		if (mv.is_capture() || mv.flags() == ENPASSANT)
+			it->score = CAPTURE_BONUS + capture_score(mv);
+
+		// the quiescence search keeps no history
+		else
+			it->score = history ? (*history)[us][mv.from()][mv.to()] : 0;
+	}
+
+	cur = begin;
+	end = moves.size();
+}
+
+/**
+ * @brief generates the quiet moves that give check
+ * they are searched in the order they are generated, there is nothing to score them by
+ */
+void MovePicker::add_quiet_checks()
+{
+	std::size_t begin = moves.size();
+	generate_quiet_checks(moves);
+	generated(begin);
+
+	cur = begin;
+	end = moves.size();
+}
+
+/**
+ * @brief hands out the best scoring move left in the current stage
+ * a selection sort step, so moves that are never reached are never sorted
+ */
+Move MovePicker::select()
+{
+	std::size_t best = cur;
+	for (std::size_t i = cur + 1; i < end; i++)
+		if (moves[i].score > moves[best].score)
+			best = i;
+
+	std::swap(moves[cur], moves[best]);
+
+	return moves[cur++].move;
+}
+
+/**
+ * @brief removes a move from the quiet moves that are left
+ * @return true if the move was there, meaning it is legal in this position
+ */
+bool MovePicker::take(Move mv)
+{
+	for (std::size_t i = cur; i < end; i++)
+	{
+		if (moves[i].move == mv)
+		{
+			// the quiet moves are the last ones generated
+			moves.remove(&moves[i]);
+			end--;
+			return true;
+		}
+	}
+
+	return false;
+}
@@ -14,41 +14,342 @@
 
 #include "perft.h"
 
-#include <functional>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <chrono>
+#include <limits>
+#include <thread>
+#include <vector>
 
 #include "board.h"
 #include "game.h"
+#include "move.h"
+#include "magic.h"
 #include "movegen.h"
+#include "zobrist.h"
+
+/**
+ * @brief counts the leaf nodes below the position on the board
+ * @param legality whether to generate legal moves, or pseudo-legal moves filtered by Board::is_legal
+ * @param generic_make whether to make moves with Board::make_move_generic, to benchmark against it
+ * @param depth number of ply to search, at least 1
+ * @return number of leaf nodes
+ */
+template<Legality legality, bool generic_make = false>
+static u64 perft_nodes(int depth)
+{
+#ifdef HASH_CHECK
+	// the incrementally updated key must always match the key computed from scratch
+	assert(board.key() == zobrist(board));
+#endif
+
+	// the legal moves of a leaf's parent only need counting
+	if (legality == LEGAL && depth == 1)
+		return count_moves();
+
+	Movelist moves;
+	generate_moves(moves, legality);
+
+	u64 nodes = 0;
+	for (Move mv : moves)
+	{
+		if (legality == PSEUDO_LEGAL && !board.is_legal(mv))
+			continue;
+
+		if (legality == PSEUDO_LEGAL && depth == 1)
+		{
+			nodes++;
+			continue;
+		}
+
+		if constexpr (generic_make)
+		{
+			board.make_move_generic(mv);
+			nodes += perft_nodes<legality, generic_make>(depth - 1);
+			board.undo_move_generic(mv);
+		}
+
+		else
+		{
+			board.make_move(mv);
+			nodes += perft_nodes<legality>(depth - 1);
+			board.undo_move(mv);
+		}
+	}
+
+	return nodes;
+}
+
+// probes and hits of the perft table by this thread, added to the table's totals when the thread is done
+static thread_local u64 table_probes = 0;
+static thread_local u64 table_hits   = 0;
+
+/**
+ * @param mb size of the table in megabytes, rounded down to a power of two number of entries
+ */
+PerftTable::PerftTable(std::size_t mb)
+{
+	count = std::bit_floor(std::max<std::size_t>(mb * 1024 * 1024 / sizeof(Entry), 1));
+
+	// value initialization zeroes every entry, and a zeroed entry never verifies for a nonzero depth
+	entries = std::make_unique<Entry[]>(count);
+}
+
+/**
+ * @brief looks up the node count of a position
+ * @param key zobrist key of the position
+ * @param depth depth the nodes were counted to
+ * @param nodes set to the stored count if the position was found
+ * @return true if the position was found at this depth
+ */
+bool PerftTable::probe(u64 key, int depth, u64 &nodes)
+{
+	auto const &e = entries[key & (count - 1)];
+
+	u64 data = e.data.load(std::memory_order_relaxed);
+	u64 k    = e.key.load(std::memory_order_relaxed) ^ data;
+
+	table_probes++;
+	if (k != key || static_cast<int>(data & 0xff) != depth)
+		return false;
+
+	table_hits++;
+	nodes = data >> 8;
+	return true;
+}
+
+/**
+ * @brief stores the node count of a position, replacing whatever was in its entry
+ * @param key zobrist key of the position
+ * @param depth depth the nodes were counted to
+ * @param nodes number of leaf nodes
+ */
+void PerftTable::store(u64 key, int depth, u64 nodes)
+{
+	auto &e  = entries[key & (count - 1)];
+	u64 data = nodes << 8 | (depth & 0xff);
+
+	e.key.store(key ^ data, std::memory_order_relaxed);
+	e.data.store(data, std::memory_order_relaxed);
+}
+
+void PerftTable::add_stats(u64 thread_probes, u64 thread_hits)
+{
+	probes += thread_probes;
+	hits   += thread_hits;
+}
+
+/**
+ * @brief fraction of probes that found their position
+ */
+double PerftTable::hit_rate() const
+{
+	return probes == 0 ? 0.0 : static_cast<double>(hits) / probes;
+}
+
+/**
+ * @brief counts the leaf nodes below the position on the board, looking up and storing
+ * the counts of positions at least 2 ply from the leaves in a table
+ * @param depth number of ply to search, at least 1
+ * @param table table of node counts
+ * @return number of leaf nodes
+ */
+static u64 perft_hashed(int depth, PerftTable &table)
+{
+	u64 nodes = 0;
+
+	if (depth == 1)
+		return count_moves();
+
+	if (table.probe(board.key(), depth, nodes))
+		return nodes;
+
+	Movelist legal_moves;
+	generate_moves(legal_moves);
+
+	for (Move mv : legal_moves)
+	{
+		board.make_move(mv);
+		nodes += perft_hashed(depth - 1, table);
+		board.undo_move(mv);
+	}
+
+	table.store(board.key(), depth, nodes);
+	return nodes;
+}
 
 /**
  * @brief test accuracy of move generation
  * @param depth number of ply to search
  * @param fen optional fen string of initial position to begin search
+ * @param legality which move generator to test, both must give the same counts
  * @return total number of nodes traversed
  */
-int perft(int depth, std::string fen)
+u64 perft(int depth, std::string fen, Legality legality)
 {
 	if (fen != "")
 		load_fen(fen);
 
-	std::function<int(int)> helper = [&](int depth) -> int
+	if (depth == 0)
+		return 1;
+
+	return legality == LEGAL ? perft_nodes<LEGAL>(depth) : perft_nodes<PSEUDO_LEGAL>(depth);
+}
+
+/**
+ * @brief collects the move sequences leading to every position a few ply below the board
+ * @param ply number of ply to go down
+ * @param line moves made so far
+ * @param frontier every complete sequence is added here
+ */
+static void perft_frontier(int ply, std::vector<Move> &line, std::vector<std::vector<Move>> &frontier)
+{
+	if (ply == 0)
 	{
-		int nodes        = 0;
-		auto legal_moves = generate_moves();
+		frontier.push_back(line);
+		return;
+	}
 
-		if (depth == 1)
-			return legal_moves.size();
+	Movelist legal_moves;
+	generate_moves(legal_moves);
+
+	for (Move mv : legal_moves)
+	{
+		line.push_back(mv);
+		board.make_move(mv);
+		perft_frontier(ply - 1, line, frontier);
+		board.undo_move(mv);
+		line.pop_back();
+	}
+}
+
+/**
+ * @brief perft split across threads
+ * @param depth number of ply to search
+ * @param threads number of threads to use
+ * @param fen optional fen string of initial position to begin search
+ * @param table optional table of node counts shared by all threads
+ * @param legality which move generator to test below the split, the table is only used with legal generation
+ * @return total number of nodes traversed
+ * 
+ * the positions two ply below the root are shared out to the threads as they become free, which
+ * balances the work far better than giving each thread a root move. every thread works on its
+ * own copy of the board.
+ */
+u64 perft_parallel(int depth, int threads, std::string fen, PerftTable *table, Legality legality)
+{
+	if (fen != "")
+		load_fen(fen);
+
+	if (legality == PSEUDO_LEGAL)
+		table = nullptr;
+
+	if (depth <= 2 || (threads <= 1 && !table))
+		return perft(depth, "", legality);
+
+	constexpr int SPLIT_PLY = 2;
+
+	std::vector<Move> line;
+	std::vector<std::vector<Move>> frontier;
+	perft_frontier(SPLIT_PLY, line, frontier);
+
+	Board const root = board;
+	std::atomic<std::size_t> next = 0;
+	std::atomic<u64> total = 0;
+
+	auto worker = [&]()
+	{
+		board        = root;
+		table_probes = 0;
+		table_hits   = 0;
 
-		for (auto mv : legal_moves)
+		u64 nodes = 0;
+		for (std::size_t i = next++; i < frontier.size(); i = next++)
 		{
-			board.make_move(mv);
-			nodes += helper(depth - 1);
-			board.undo_move(mv);
+			for (auto mv : frontier[i])
+				board.make_move(mv);
+
+			if (table)
+				nodes += perft_hashed(depth - SPLIT_PLY, *table);
+			else if (legality == LEGAL)
+				nodes += perft_nodes<LEGAL>(depth - SPLIT_PLY);
+			else
+				nodes += perft_nodes<PSEUDO_LEGAL>(depth - SPLIT_PLY);
+
+			for (auto it = frontier[i].rbegin(); it != frontier[i].rend(); ++it)
+				board.undo_move(*it);
 		}
-		return nodes;
+
+		total += nodes;
+
+		if (table)
+			table->add_stats(table_probes, table_hits);
 	};
 
-	return helper(depth);
+	std::vector<std::thread> pool;
+	for (int i = 0; i < std::max(threads, 1); i++)
+		pool.emplace_back(worker);
+
+	for (auto &t : pool)
+		t.join();
+
+	return total;
+}
+
+/**
+ * @brief collects move generation statistics for the leaves below the position on the board
+ * @param depth number of ply to search
+ * @param pd statistics to add to
+ * @return number of leaf nodes
+ */
+static u64 perft_detail_nodes(int depth, PerftDetail &pd)
+{
+#ifdef HASH_CHECK
+	assert(board.key() == zobrist(board));
+#endif
+
+	u64 nodes = 0;
+
+	Movelist legal_moves;
+	generate_moves(legal_moves);
+
+	if (depth == 0)
+	{
+		if (board.in_check(board.mover()))
+		{
+			pd.checks++;
+
+			if (legal_moves.size() == 0)
+				pd.checkmates++;
+		}
+
+		return 1;
+	}
+
+	for (Move mv : legal_moves)
+	{
+		if (depth == 1)
+		{
+			if (mv.is_capture())
+				pd.captures++;
+			if (mv.is_castle())
+				pd.castles++;
+			if (mv.is_promotion())
+				pd.promotions++;
+			if (mv.flags() == ENPASSANT)
+			{
+				pd.captures++;
+				pd.enpassants++;
+			}
+		}
+		board.make_move(mv);
+		nodes += perft_detail_nodes(depth - 1, pd);
+		board.undo_move(mv);
+	}
+
+	return nodes;
 }
 
 /**
@@ -63,49 +364,158 @@ PerftDetail perft_detail(int depth, std::string fen)
 		load_fen(fen);
 
 	PerftDetail pd;
+	pd.nodes = perft_detail_nodes(depth, pd);
+	return pd;
+}
+
+/**
+ * @brief measures move generation throughput on the standard perft positions
+ * @param threads number of threads to run perft on
+ * 
+ * prints the node count, time, and nodes per second of each position along with the total,
+ * and flags any position whose node count differs from the known correct result.
+ * each position is counted with both the legal and the pseudo-legal move generator
+ */
+void perft_bench(int threads)
+{
+	struct BenchPosition
+	{
+		std::string fen;
+		int depth;
+		u64 expected;
+	};
+
+	// https://www.chessprogramming.org/Perft_Results
+	const BenchPosition positions[] = {
+		{ "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", 5, 4865609 },
+		{ "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1", 4, 4085603 },
+		{ "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1", 6, 11030083 },
+		{ "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1", 4, 422333 },
+		{ "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8", 4, 2103487 },
+		{ "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10", 4, 3894594 },
+	};
+
+	u64 total_nodes[2]      = { 0, 0 };
+	double total_seconds[2] = { 0, 0 };
 
-	std::function<int(int)> helper = [&](int depth) -> int
+	std::cout << "slider attacks: " << Magic::backend_name() << " board: " << (COPY_MAKE_BOARD ? "copy-make" : "make/unmake")
+	          << " threads: " << threads << "\n";
+
+	for (auto const &pos : positions)
 	{
-		int nodes        = 0;
-		auto legal_moves = generate_moves();
+		std::cout << pos.fen << "\n";
 
-		if (depth == 0)
+		for (auto legality : { LEGAL, PSEUDO_LEGAL })
 		{
-			if (board.in_check(board.mover()))
-			{
-				pd.checks++;
+			auto start = std::chrono::steady_clock::now();
+			u64 nodes  = perft_parallel(pos.depth, threads, pos.fen, nullptr, legality);
+			std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+			total_nodes[legality]   += nodes;
+			total_seconds[legality] += elapsed.count();
+
+			std::cout << "\t" << (legality == LEGAL ? "legal       " : "pseudo-legal") << " depth " << pos.depth
+			          << " nodes " << nodes << " time " << elapsed.count() << "s nps "
+			          << static_cast<long long>(nodes / elapsed.count());
+			if (nodes != pos.expected)
+				std::cout << " (expected " << pos.expected << ")";
+			std::cout << "\n";
+		}
+	}
 
-				if (legal_moves.size() == 0)
-					pd.checkmates++;
+	for (auto legality : { LEGAL, PSEUDO_LEGAL })
+	{
+		std::cout << "total " << (legality == LEGAL ? "legal       " : "pseudo-legal") << " nodes "
+		          << total_nodes[legality] << " time " << total_seconds[legality] << "s nps "
+		          << static_cast<long long>(total_nodes[legality] / total_seconds[legality]) << "\n";
+	}
+
+	/*
+	 * the specialized make and undo against the generic ones. the two are run alternately and the best of
+	 * several runs of each is kept, so neither is penalized for running first on cold caches or during a
+	 * noisy moment. the parents of the leaves only count their moves, so perft makes a move for about
+	 * every 30 leaves and its time is mostly move generation, the make/undo loop isolates their cost
+	 */
+	constexpr int runs   = 5;
+	constexpr int rounds = 20000;
+
+	u64 perft_nodes_total = 0;
+	u64 perft_makes       = 0;
+	long long pairs       = 0;
+	double perft_best[2]  = { std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity() };
+	double pairs_best[2]  = { std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity() };
+
+	// a perft to depth d makes one move for every position from 1 to d - 1 ply below the root
+	for (auto const &pos : positions)
+		for (int depth = 1; depth < pos.depth; depth++)
+			perft_makes += perft(depth, pos.fen);
+
+	for (int run = 0; run < runs; run++)
+	{
+		for (bool generic : { false, true })
+		{
+			u64 nodes  = 0;
+			auto start = std::chrono::steady_clock::now();
+			for (auto const &pos : positions)
+			{
+				load_fen(pos.fen);
+				nodes += generic ? perft_nodes<LEGAL, true>(pos.depth) : perft_nodes<LEGAL>(pos.depth);
 			}
+			std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
 
-			return 1;
+			perft_nodes_total  = nodes;
+			perft_best[generic] = std::min(perft_best[generic], elapsed.count());
 		}
 
-		for (auto mv : legal_moves)
+		// make and undo every legal move of each position many times over
+		for (bool generic : { false, true })
 		{
-			if (depth == 1)
+			pairs      = 0;
+			auto start = std::chrono::steady_clock::now();
+			for (auto const &pos : positions)
 			{
-				if (mv.is_capture())
-					pd.captures++;
-				if (mv.is_castle())
-					pd.castles++;
-				if (mv.is_promotion())
-					pd.promotions++;
-				if (mv.flags() == ENPASSANT)
+				load_fen(pos.fen);
+				Movelist legal_moves;
+				generate_moves(legal_moves);
+
+				for (int i = 0; i < rounds; i++)
 				{
-					pd.captures++;
-					pd.enpassants++;
+					for (Move mv : legal_moves)
+					{
+						if (generic)
+						{
+							board.make_move_generic(mv);
+							board.undo_move_generic(mv);
+						}
+
+						else
+						{
+							board.make_move(mv);
+							board.undo_move(mv);
+						}
+					}
 				}
+
+				pairs += static_cast<long long>(rounds) * legal_moves.size();
 			}
-			board.make_move(mv);
-			nodes += helper(depth - 1);
-			board.undo_move(mv);
+			std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+			pairs_best[generic] = std::min(pairs_best[generic], elapsed.count());
 		}
+	}
 
-		return nodes;
-	};
+	for (bool generic : { false, true })
+	{
+		std::cout << "perft " << (generic ? "generic make/undo    " : "specialized make/undo") << " nodes "
+		          << perft_nodes_total << " makes " << perft_makes << " best of " << runs << " time "
+		          << perft_best[generic] << "s nps " << static_cast<long long>(perft_nodes_total / perft_best[generic])
+		          << "\n";
+	}
 
-	pd.nodes = helper(depth);
-	return pd;
+	for (bool generic : { false, true })
+	{
+		std::cout << (generic ? "generic " : "specialized ") << "make/undo pairs " << pairs << " best of " << runs
+		          << " time " << pairs_best[generic] << "s per second "
+		          << static_cast<long long>(pairs / pairs_best[generic]) << "\n";
+	}
 }
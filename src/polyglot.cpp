@@ -10,10 +10,18 @@
 
 #include "polyglot.h"
 
-#include <fstream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
 #include <iostream>
+#include <random>
+
+#include "movegen.h"
 
-#include "zobrist.h"
+PolyglotBook book;
 
 static u64 swap64(u64 x)
 {
@@ -33,32 +41,139 @@ static u16 swap16(u16 x)
 	return (x >> 8) | (x << 8);
 }
 
-Move polyglot(const Board &board)
+PolyglotBook::~PolyglotBook()
+{
+	close();
+}
+
+/**
+ * @brief maps a book into memory, closing the book that was open before
+ * @param path path to the book file
+ * @return true if the book was opened
+ */
+bool PolyglotBook::open(std::string const &path)
 {
-	const std::string book_name = "./book/human.bin";
-	u64 key;
-	u16 move;
-	u16 weight;
-	u32 learn;
+	close();
+
+	int fd = ::open(path.c_str(), O_RDONLY);
+	if (fd < 0)
+	{
+		std::cerr << "Error opening book " << path << "\n";
+		return false;
+	}
+
+	struct stat st;
+	if (fstat(fd, &st) < 0 || st.st_size < static_cast<off_t>(sizeof(PolyglotEntry)))
+	{
+		std::cerr << "Error opening book " << path << "\n";
+		::close(fd);
+		return false;
+	}
+
+	void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
 
-	auto hash = zobrist(board);
+	// the mapping stays valid after the file is closed
+	::close(fd);
 
-	std::ifstream book(book_name, std::ios::in | std::ios::binary);
-	if (!book.good())
+	if (data == MAP_FAILED)
 	{
-		std::cerr << "Error opening book " << book_name << "\n";
+		std::cerr << "Error mapping book " << path << "\n";
 		return false;
 	}
 
-	while (book.peek() != EOF)
+	entries = static_cast<PolyglotEntry const *>(data);
+	size    = st.st_size;
+	count   = size / sizeof(PolyglotEntry);
+
+	return true;
+}
+
+void PolyglotBook::close()
+{
+	if (entries)
+		munmap(const_cast<PolyglotEntry *>(entries), size);
+
+	entries = nullptr;
+	count   = 0;
+	size    = 0;
+}
+
+/**
+ * @brief finds every entry for a position
+ * @param key polyglot zobrist key of the position
+ * @return the entries for the position in native byte order, empty if it is not in the book
+ */
+std::vector<PolyglotEntry> PolyglotBook::probe(u64 key) const
+{
+	std::vector<PolyglotEntry> found;
+
+	auto first = std::lower_bound(entries, entries + count, key,
+	                              [](PolyglotEntry const &e, u64 k) { return swap64(e.key) < k; });
+
+	for (auto e = first; e != entries + count && swap64(e->key) == key; e++)
+		found.push_back({ key, swap16(e->move), swap16(e->weight), swap32(e->learn) });
+
+	return found;
+}
+
+/**
+ * @brief finds the legal move that a polyglot move describes
+ * @param poly_move polyglot move: bits 0-5 to square, bits 6-11 from square, bits 12-14 promotion piece
+ * @return the legal move, or an empty move if there is none (the entry belongs to another position)
+ */
+static Move to_legal_move(u16 poly_move)
+{
+	Square to   = static_cast<Square>(poly_move & 0x3f);
+	Square from = static_cast<Square>(poly_move >> 6 & 0x3f);
+	int promo   = poly_move >> 12 & 0x7;
+
+	// castling is encoded as the king capturing its own rook, e1h1 rather than e1g1
+	if (board.piece_on(from) == KING && (to == from + 3 || to == from - 4))
+		to = static_cast<Square>(to > from ? from + 2 : from - 2);
+
+	Movelist legal_moves;
+	generate_moves(legal_moves);
+
+	for (Move mv : legal_moves)
+	{
+		if (mv.from() != from || mv.to() != to)
+			continue;
+
+		// knight, bishop, rook, queen in both encodings
+		if (promo == 0 ? !mv.is_promotion() : mv.is_promotion() && (mv.flags() & 0x3) == promo - 1)
+			return mv;
+	}
+
+	return Move();
+}
+
+/**
+ * @brief picks a book move for the position on the board, more often the higher its weight
+ * @return the book move, or an empty move if the position is not in the book
+ */
+Move polyglot()
+{
+	if (!book.is_open())
+		return Move();
+
+	auto entries = book.probe(board.key());
+
+	u32 total = 0;
+	for (auto const &e : entries)
+		total += e.weight;
+
+	if (total == 0)
+		return Move();
+
+	static std::mt19937 rng(std::random_device{}());
+	u32 pick = std::uniform_int_distribution<u32>(0, total - 1)(rng);
+
+	for (auto const &e : entries)
 	{
-		book.read((char *) &key, sizeof(key));
-		book.read((char *) &move, sizeof(move));
-		book.read((char *) &weight, sizeof(weight));
-		book.read((char *) &learn, sizeof(learn));
+		if (pick < e.weight)
+			return to_legal_move(e.move);
 
-		if (swap64(key) == hash)
-			return Move(swap16(move));
+		pick -= e.weight;
 	}
 
 	return Move();
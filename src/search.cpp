@@ -10,81 +10,206 @@
 
 #include "search.h"
 
-#include <bit>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <iostream>
 #include <limits>
 #include <thread>
+#include <utility>
+#include <vector>
 
 #include "board.h"
-#include "constants.h"
+#include "game.h"
 #include "move.h"
 #include "movegen.h"
+#include "movepick.h"
+#include "tt.h"
 #include "util.h"
 
-std::tuple<Move, float> search_time_helper();
+SearchController searcher;
 
-Move best_move;
-float max = -std::numeric_limits<float>::infinity();
+// every node keeps its moves on the move stack until it returns, and a search goes no further than MAX_PLY
+static_assert(MOVE_STACK_SIZE >= (MAX_PLY + 1) * N_MOVES);
+
+// nodes a search thread searches between polls of the search controller
+constexpr u64 POLL_INTERVAL = 2048;
+
+// nodes this thread has searched since it last polled
+static thread_local u64 nodes_since_poll = 0;
+
+// set once this thread has seen the search being stopped, scores are garbage from then on
+static thread_local bool stopped = false;
+
+// search state of this thread
+static thread_local SearchThread *this_thread = nullptr;
+
+// move ordering tables of this thread, cleared at the start of every search
+static thread_local Move killers[MAX_DEPTH + 1][2];
+static thread_local HistoryTable history;
+
+constexpr int HISTORY_MAX = 1 << 24;
+
+/*
+ * helper threads skip some iterations so they are searching at different depths than the main
+ * thread and each other, rather than all searching the same tree in the same order
+ */
+constexpr int SKIP_SIZE[]  = { 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4 };
+constexpr int SKIP_PHASE[] = { 0, 1, 0, 1, 2, 3, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 6, 7 };
+
+/**
+ * @brief rewards a quiet move for causing a beta cutoff
+ * @param c color that made the move
+ * @param mv the move
+ * @param depth depth of the cutoff, deeper cutoffs save more work and count for more
+ */
+static void update_history(Color c, Move mv, int depth)
+{
+	int &entry = history[c][mv.from()][mv.to()];
+	entry += depth * depth;
+
+	// keep the scores from overflowing in long searches, while keeping their order
+	if (entry >= HISTORY_MAX)
+		for (auto &from : history[c])
+			for (auto &score : from)
+				score /= 2;
+}
+
+/**
+ * @brief converts a score relative to the root into one relative to the position it is stored for
+ * a mate score counts the ply to the mate from the root, but the same position can be reached at
+ * any ply, so the table counts them from the stored position instead
+ */
+static float score_to_tt(float score, int ply)
+{
+	if (score >= MATE_BOUND)
+		return score + ply;
+
+	if (score <= -MATE_BOUND)
+		return score - ply;
+
+	return score;
+}
+
+/**
+ * @brief converts a score from the transposition table back into one relative to the root
+ */
+static float score_from_tt(float score, int ply)
+{
+	if (score >= MATE_BOUND)
+		return score - ply;
+
+	if (score <= -MATE_BOUND)
+		return score + ply;
+
+	return score;
+}
 
 /**
  * @brief search a position for the best move using the alpha-beta algorithm
  * @param depth number of ply into the future to search
+ * @param ply number of ply from the root
  * @return evaluation
  */
-float alphabeta(int depth, float alpha, float beta)
+float alphabeta(int depth, int ply, float alpha, float beta)
 {
 	if (depth == 0)
-		return quiesce(alpha, beta);
+		return quiesce(alpha, beta, 0, ply);
 
-	auto legal_moves = generate_moves();
-	legal_moves.order();
+	if (++nodes_since_poll == POLL_INTERVAL)
+		stopped = searcher.poll(*this_thread, std::exchange(nodes_since_poll, 0));
 
-	for (const auto mv : legal_moves)
+	if (stopped)
+		return 0;
+
+	// check for a stored result of this position
+	TTEntry entry;
+	Move hash_move;
+	if (tt.probe(board.key(), entry))
 	{
-		board.make_move(mv);
+		hash_move = entry.move();
 
-		// board is invalid, so this must be very bad for us
-		if (board.pieces(KING, board.mover()) == 0)
+		if (entry.depth() >= depth)
 		{
-			board.undo_move(mv);
-			return -20000;
+			float score = score_from_tt(entry.score(), ply);
+
+			if (entry.bound() == BOUND_EXACT)
+				return std::clamp(score, alpha, beta);
+
+			if (entry.bound() == BOUND_LOWER && score >= beta)
+				return beta;
+
+			if (entry.bound() == BOUND_UPPER && score <= alpha)
+				return alpha;
 		}
+	}
+
+	// the best move from the last time we saw this position is searched first
+	MovePicker picker(hash_move, killers[ply], history);
+
+	Move best;
+	Bound bound = BOUND_UPPER;
+	int legal   = 0;
 
-		float score = -alphabeta(depth - 1, -beta, -alpha);
+	for (Move mv = picker.next(); !mv.is_empty(); mv = picker.next())
+	{
+		// checks are searched a ply deeper so the horizon does not fall right before the reply
+		int extension = ply + depth < MAX_DEPTH && board.gives_check(mv);
+		legal++;
+
+		board.make_move(mv);
+		float score = -alphabeta(depth - 1 + extension, ply + 1, -beta, -alpha);
 		board.undo_move(mv);
+
+		// the search was stopped, so score is meaningless and must not be stored
+		if (stopped)
+			return 0;
+
 		if (score >= beta)
+		{
+			// remember quiet moves that refute a position, they are likely to refute its siblings too
+			if (!mv.is_capture() && mv.flags() != ENPASSANT && !mv.is_promotion())
+			{
+				if (killers[ply][0] != mv)
+				{
+					killers[ply][1] = killers[ply][0];
+					killers[ply][0] = mv;
+				}
+
+				update_history(board.mover(), mv, depth);
+			}
+
+			tt.store(board.key(), depth, BOUND_LOWER, score_to_tt(beta, ply), mv);
 			return beta;
+		}
 
 		if (score > alpha)
+		{
 			alpha = score;
+			best  = mv;
+			bound = BOUND_EXACT;
+		}
 	}
 
+	// checkmate or stalemate
+	if (legal == 0)
+		return board.in_check(board.mover()) ? -MATE + ply : 0;
+
+	tt.store(board.key(), depth, bound, score_to_tt(alpha, ply), best);
 	return alpha;
 };
 
 /**
- * @brief use an algorithm f to search positions
+ * @brief search a position to a fixed depth
  * @param depth number of ply into the future to search
  * @return tuple of <best_move, evaluation>
  */
 std::tuple<Move, float> search(int depth)
 {
-	auto legal_moves = generate_moves();
-	legal_moves.order();
-
-	for (const auto mv : legal_moves)
-	{
-		board.make_move(mv);
-		float score = -alphabeta(depth - 1, -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity());
-		board.undo_move(mv);
+	searcher.start(board, { .depth = depth });
+	searcher.wait();
 
-		if (score > max)
-		{
-			max = score;
-			best_move = mv;
-		}
-	}
-
-	return std::make_tuple(best_move, max);
+	return searcher.result();
 }
 
 /**
@@ -98,98 +223,420 @@ std::tuple<Move, float> search_time(int game_time, int our_time)
 	// search for 20% of our time or 1/60th of the game time, whichever is smaller
 	int time = std::min(our_time / 5, game_time / 60);
 
-	std::thread t(search_time_helper);
-	t.detach();
-	std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(time));
+	auto print_info = [](SearchInfo const &info)
+	{
+		std::cerr << "current depth: " << info.depth << " nodes: " << info.nodes << " hashfull: " << tt.hashfull()
+		          << " tt hit rate: " << tt.hit_rate() << "\n";
+	};
+
+	searcher.start(board, { .movetime = std::max(time, 1) }, print_info);
+	searcher.wait();
 
-	return std::make_tuple(best_move, max);
+	return searcher.result();
 }
 
 /**
- * @brief evaluate a position
- * @return the evaluation - it is relative to the player to move so a positive score is
- * winning for the player while a negative score is winning for the opponent
+ * @brief measures time to depth of the search on a few middlegame positions
+ * @param threads number of search threads
+ * 
+ * every position is searched to the same fixed depth from an empty transposition table, so
+ * running this with different numbers of threads shows how well the search scales
  */
-float evaluate()
+void search_bench(int threads)
 {
-	float eval = 0.0f;
+	constexpr int depth = 6;
 
-	eval += std::popcount(board.pieces(PAWN, WHITE)) * Constants::PIECE_VALUE[PAWN];
-	eval += std::popcount(board.pieces(KNIGHT, WHITE)) * Constants::PIECE_VALUE[KNIGHT];
-	eval += std::popcount(board.pieces(BISHOP, WHITE)) * Constants::PIECE_VALUE[BISHOP];
-	eval += std::popcount(board.pieces(ROOK, WHITE)) * Constants::PIECE_VALUE[ROOK];
-	eval += std::popcount(board.pieces(QUEEN, WHITE)) * Constants::PIECE_VALUE[QUEEN];
+	const std::string positions[] = {
+		"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+		"rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+		"r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10",
+	};
 
-	eval -= std::popcount(board.pieces(PAWN, BLACK)) * Constants::PIECE_VALUE[PAWN];
-	eval -= std::popcount(board.pieces(KNIGHT, BLACK)) * Constants::PIECE_VALUE[KNIGHT];
-	eval -= std::popcount(board.pieces(BISHOP, BLACK)) * Constants::PIECE_VALUE[BISHOP];
-	eval -= std::popcount(board.pieces(ROOK, BLACK)) * Constants::PIECE_VALUE[ROOK];
-	eval -= std::popcount(board.pieces(QUEEN, BLACK)) * Constants::PIECE_VALUE[QUEEN];
+	searcher.set_threads(threads);
 
-	int perspective = board.mover() == WHITE ? 1 : -1;
+	u64 total_nodes      = 0;
+	double total_seconds = 0;
 
-	return eval * perspective;
+	for (auto const &fen : positions)
+	{
+		load_fen(fen);
+		tt.clear();
+
+		auto start = std::chrono::steady_clock::now();
+		auto [move, score] = search(depth);
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+		total_nodes   += searcher.nodes();
+		total_seconds += elapsed.count();
+
+		std::cout << "search " << fen << " depth " << depth << " threads " << threads << " time " << elapsed.count()
+		          << "s nodes " << searcher.nodes() << " best " << move << "\n";
+	}
+
+	std::cout << "total search depth " << depth << " threads " << threads << " time " << total_seconds << "s nodes "
+	          << total_nodes << " nps " << static_cast<long long>(total_nodes / total_seconds) << "\n";
+}
+
+SearchController::~SearchController()
+{
+	stop();
+	wait();
+}
+
+/**
+ * @brief starts searching a position in the background, waiting for any previous search to finish first
+ * @param position the position to search, it is copied so the caller's board may change during the search
+ * @param search_limits when to stop searching, a search with no limits runs until it is stopped
+ * @param info called from the main search thread after every completed iteration
+ * @param done called from the main search thread with the result once the search has finished
+ */
+void SearchController::start(Board const &position, SearchLimits const &search_limits, InfoCallback info, DoneCallback done)
+{
+	wait();
+
+	// nothing is carried over from the previous search except the transposition table
+	root         = position;
+	limits       = search_limits;
+	on_iteration = std::move(info);
+	on_done      = std::move(done);
+	start_time   = std::chrono::steady_clock::now();
+	stop_search.store(false);
+	nodes_searched.store(0);
+	tt.new_search();
+
+	threads.assign(num_threads, SearchThread());
+	for (int i = 0; i < num_threads; i++)
+		threads[i] = { i, Move(), -std::numeric_limits<float>::infinity(), 0 };
+
+	main_thread = std::thread(&SearchController::run, this);
+}
+
+/**
+ * @brief asks the running search to stop, without waiting for it
+ * search threads notice the next time they poll
+ */
+void SearchController::stop()
+{
+	stop_search.store(true);
+	stop_search.notify_all();
+}
+
+/**
+ * @brief waits for the running search to finish
+ */
+void SearchController::wait()
+{
+	if (main_thread.joinable())
+		main_thread.join();
+}
+
+/**
+ * @brief the result of the last search, which must have finished
+ * @return tuple of <best_move, evaluation> of the main thread, or of a helper thread that completed
+ * a deeper iteration
+ */
+std::tuple<Move, float> SearchController::result() const
+{
+	if (threads.empty())
+		return std::make_tuple(Move(), 0.0f);
+
+	SearchThread const *best = &threads[0];
+	for (auto const &t : threads)
+		if (t.depth > best->depth)
+			best = &t;
+
+	return std::make_tuple(best->best_move, best->max);
 }
 
-std::tuple<Move, float> search_time_helper()
+/**
+ * @brief sets the number of threads used by searches started from now on
+ * @param n number of threads, at least 1
+ */
+void SearchController::set_threads(int n)
 {
-	auto legal_moves = generate_moves();
+	num_threads = std::max(n, 1);
+}
+
+/**
+ * @brief counts the nodes a search thread searched since it last polled, and checks the limits
+ * @param thread the polling thread, only the main thread checks limits
+ * @param nodes number of nodes searched since the thread last polled
+ * @return true if the search has been stopped
+ */
+bool SearchController::poll(SearchThread const &thread, u64 nodes)
+{
+	u64 total = nodes_searched.fetch_add(nodes, std::memory_order_relaxed) + nodes;
+
+	// always finish the first iteration, so there is a move to play
+	if (thread.id == 0 && thread.depth > 0)
+	{
+		auto elapsed = std::chrono::steady_clock::now() - start_time;
+
+		if (limits.movetime && elapsed >= std::chrono::milliseconds(limits.movetime))
+			stop();
+
+		if (limits.nodes && total >= limits.nodes)
+			stop();
+	}
+
+	return stop_search.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief body of the main search thread, which runs the helper threads alongside itself
+ */
+void SearchController::run()
+{
+	std::vector<std::thread> helpers;
+	for (int i = 1; i < num_threads; i++)
+		helpers.emplace_back(&SearchController::iterative_deepening, this, std::ref(threads[i]));
+
+	iterative_deepening(threads[0]);
+
+	// an infinite search only finishes when it is told to, even if it ran out of depth
+	if (limits.infinite)
+		stop_search.wait(false);
+
+	stop();
+	for (auto &h : helpers)
+		h.join();
+
+	if (on_done)
+	{
+		auto [move, score] = result();
+		on_done(move, score);
+	}
+}
+
+/**
+ * @brief searches with increasing depth until the search is stopped or a limit is reached
+ * @param thread state of the search thread, updated after every completed iteration
+ */
+void SearchController::iterative_deepening(SearchThread &thread)
+{
+	board            = root;
+	this_thread      = &thread;
+	nodes_since_poll = 0;
+	stopped          = false;
+
+	std::fill(&killers[0][0], &killers[0][0] + std::size(killers) * 2, Move());
+	std::fill(&history[0][0][0], &history[0][0][0] + sizeof(history) / sizeof(int), 0);
+
+	Movelist legal_moves;
+	generate_moves(legal_moves);
 	legal_moves.order();
 
-	max = -std::numeric_limits<float>::infinity();
-	int depth = 1;
+	// play something if the search is stopped before the first iteration completes
+	if (thread.id == 0 && legal_moves.size() > 0)
+		thread.best_move = *legal_moves.begin();
+
+	// there is no move to play, the result is just the score of checkmate or stalemate
+	if (legal_moves.size() == 0)
+		thread.max = board.in_check(board.mover()) ? -MATE : 0;
 
-	while (1)
+	int max_depth = limits.depth ? std::min(limits.depth, MAX_DEPTH) : MAX_DEPTH;
+
+	for (int depth = 1; !stopped && depth <= max_depth; depth++)
 	{
-		for (const auto mv : legal_moves)
+		if (thread.id > 0)
+		{
+			int i = (thread.id - 1) % std::size(SKIP_SIZE);
+			if ((depth + SKIP_PHASE[i]) / SKIP_SIZE[i] % 2)
+				continue;
+		}
+
+		// search the best move of the previous iteration first
+		if (!thread.best_move.is_empty())
+			legal_moves.move_to_front(thread.best_move);
+
+		Move best_move;
+		float max = -std::numeric_limits<float>::infinity();
+
+		for (Move const mv : legal_moves)
 		{
+			int extension = depth < MAX_DEPTH && board.gives_check(mv);
+
 			board.make_move(mv);
-			float score = -alphabeta(depth - 1, -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity());
+			float score = -alphabeta(depth - 1 + extension, 1, -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity());
 			board.undo_move(mv);
 
+			if (stopped)
+				break;
+
 			if (score > max)
 			{
-				max = score;
+				max       = score;
 				best_move = mv;
 			}
 		}
 
-		std::cerr << "current depth: " << depth << "\n";
-		depth += 1;
+		// the hit rate reported after the iteration counts the probes of every thread
+		tt.add_thread_stats();
+
+		if (stopped || best_move.is_empty())
+			break;
+
+		thread.best_move = best_move;
+		thread.max       = max;
+		thread.depth     = depth;
+
+		if (thread.id == 0 && on_iteration)
+			report(thread);
+	}
+
+	poll(thread, nodes_since_poll);
+	nodes_since_poll = 0;
+}
+
+/**
+ * @brief passes the progress of the main thread to the info callback
+ * the principal variation is followed through the hash moves stored in the transposition table
+ */
+void SearchController::report(SearchThread const &thread)
+{
+	SearchInfo info;
+	info.depth = thread.depth;
+	info.score = thread.max;
+	info.nodes = nodes() + nodes_since_poll;
+	info.time  = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start_time);
+
+	Move mv = thread.best_move;
+	while (!mv.is_empty() && static_cast<int>(info.pv.size()) < thread.depth)
+	{
+		// an entry can be overwritten or collide with another position, so the move must be checked
+		Movelist legal_moves;
+		generate_moves(legal_moves);
+		if (std::find_if(legal_moves.begin(), legal_moves.end(), [&](auto const &sm) { return sm.move == mv; }) == legal_moves.end())
+			break;
+
+		info.pv.push_back(mv);
+		board.make_move(mv);
+
+		TTEntry entry;
+		mv = tt.probe(board.key(), entry) ? entry.move() : Move();
 	}
+
+	for (auto it = info.pv.rbegin(); it != info.pv.rend(); ++it)
+		board.undo_move(*it);
+
+	on_iteration(info);
+}
+
+/**
+ * @brief evaluate a position
+ * @return the evaluation - it is relative to the player to move so a positive score is
+ * winning for the player while a negative score is winning for the opponent
+ * 
+ * the board keeps the material and piece-square score up to date as moves are made, so this only
+ * blends its middlegame and endgame parts by how much material is left
+ */
+float evaluate()
+{
+	Score psq = board.psq();
+	int phase = std::min(board.phase(), MAX_PHASE);
+
+	float eval = (psq.mg * phase + psq.eg * (MAX_PHASE - phase)) / MAX_PHASE;
+
+	int perspective = board.mover() == WHITE ? 1 : -1;
+
+	return eval * perspective;
 }
 
 /**
  * @brief quiescence search - continue searching positions with no captures
  * @param alpha alpha value from alpha-beta search
  * @param beta alpha value from alpha-beta search
+ * @param depth 0 at the first quiescence ply and negative after, quiet checks are only searched at depth 0
+ * @param ply number of ply from the root
  * @return evaluation
+ * 
+ * a side in check cannot stand pat, it searches every evasion instead, so the checks played at the
+ * first ply are actually answered
  */
-float quiesce(float alpha, float beta)
+float quiesce(float alpha, float beta, int depth, int ply)
 {
-	auto eval = evaluate();
+	if (++nodes_since_poll == POLL_INTERVAL)
+		stopped = searcher.poll(*this_thread, std::exchange(nodes_since_poll, 0));
 
-	if (eval >= beta)
-		return beta;
+	if (stopped)
+		return 0;
 
-	if (alpha < eval)
-		alpha = eval;
+	// quiescence results are stored with depth 0
+	TTEntry entry;
+	Move hash_move;
+	if (tt.probe(board.key(), entry))
+	{
+		float score = score_from_tt(entry.score(), ply);
+		hash_move   = entry.move();
+
+		if (entry.bound() == BOUND_EXACT)
+			return std::clamp(score, alpha, beta);
+
+		if (entry.bound() == BOUND_LOWER && score >= beta)
+			return beta;
+
+		if (entry.bound() == BOUND_UPPER && score <= alpha)
+			return alpha;
+	}
+
+	if (ply >= MAX_PLY)
+		return evaluate();
+
+	bool in_check = board.in_check(board.mover());
+	Bound bound   = BOUND_UPPER;
+
+	if (!in_check)
+	{
+		auto eval = evaluate();
+
+		if (eval >= beta)
+			return beta;
 
-	auto capture_moves = generate_captures();
-	capture_moves.order();
+		if (alpha < eval)
+		{
+			alpha = eval;
+			bound = BOUND_EXACT;
+		}
+	}
 
-	for (const auto mv : capture_moves)
+	// the hash move is only searched if it is a capture, or if we are in check
+	MovePicker picker(hash_move, depth == 0);
+	Move best;
+	int searched = 0;
+
+	for (Move mv = picker.next(); !mv.is_empty(); mv = picker.next())
 	{
+		// a move that loses material in the exchange that follows will not raise alpha
+		if (!in_check && !board.see(mv, 0))
+			continue;
+
+		searched++;
+
 		board.make_move(mv);
-		float score = -quiesce(-beta, -alpha);
+		float score = -quiesce(-beta, -alpha, depth - 1, ply + 1);
 		board.undo_move(mv);
 
+		if (stopped)
+			return 0;
+
 		if (score >= beta)
+		{
+			tt.store(board.key(), 0, BOUND_LOWER, score_to_tt(beta, ply), mv);
 			return beta;
+		}
 
 		if (score > alpha)
+		{
 			alpha = score;
+			best  = mv;
+			bound = BOUND_EXACT;
+		}
 	}
 
+	// every evasion is searched, so running out of them is checkmate
+	if (in_check && searched == 0)
+		return -MATE + ply;
+
+	tt.store(board.key(), 0, bound, score_to_tt(alpha, ply), best);
 	return alpha;
 }
@@ -0,0 +1,194 @@
+/** excalibur
+ * License: GPLv2
+ * See LICENSE for full license text
+ * Author: Sam Kravitz
+ * 
+ * FILE: tt.cpp
+ * DATE: October 17th, 2026
+ * DESCRIPTION: transposition table for storing search results
+ */
+
+#include "tt.h"
+
+#include <bit>
+#include <utility>
+
+TranspositionTable tt;
+
+// probes and hits by this thread, added to the table's totals by add_thread_stats so search threads
+// do not fight over a cache line on every probe
+static thread_local u64 thread_probes = 0;
+static thread_local u64 thread_hits   = 0;
+
+TranspositionTable::TranspositionTable()
+{
+	generation = 0;
+	resize(DEFAULT_HASH_MB);
+}
+
+// reads an entry, returning an empty entry if it does not verify
+static TTEntry load(TTSlot const &slot)
+{
+	u64 data = slot.data.load(std::memory_order_relaxed);
+	u64 key  = slot.key.load(std::memory_order_relaxed) ^ data;
+
+	return { key, data };
+}
+
+/**
+ * @brief resizes the table, clearing all entries
+ * @param mb maximum size of the table in megabytes, rounded down to a power of two number of buckets
+ */
+void TranspositionTable::resize(std::size_t mb)
+{
+	count = (mb * 1024 * 1024) / sizeof(TTBucket);
+	if (count == 0)
+		count = 1;
+
+	count   = std::bit_floor(count);
+	buckets = std::make_unique<TTBucket[]>(count);
+	clear();
+}
+
+void TranspositionTable::clear()
+{
+	for (std::size_t i = 0; i < count; i++)
+	{
+		for (auto &e : buckets[i].entries)
+		{
+			e.key.store(0, std::memory_order_relaxed);
+			e.data.store(0, std::memory_order_relaxed);
+		}
+	}
+
+	generation = 0;
+}
+
+/**
+ * @brief marks the start of a new search
+ * entries from previous searches are kept but are the first to be replaced
+ * must not be called while a search is running
+ */
+void TranspositionTable::new_search()
+{
+	generation = (generation + 1) & 0x3f;
+	probes     = 0;
+	hits       = 0;
+}
+
+/**
+ * @brief adds the probes and hits of the calling thread since it last called this to the table's totals
+ */
+void TranspositionTable::add_thread_stats()
+{
+	probes += std::exchange(thread_probes, 0);
+	hits   += std::exchange(thread_hits, 0);
+}
+
+/**
+ * @brief looks up a position in the table
+ * @param key zobrist key of the position
+ * @param entry set to the stored entry if the position was found
+ * @return true if the position was found
+ */
+bool TranspositionTable::probe(u64 key, TTEntry &entry)
+{
+	thread_probes++;
+
+	for (auto const &slot : bucket(key).entries)
+	{
+		TTEntry e = load(slot);
+		if (e.key == key && e.bound() != BOUND_NONE)
+		{
+			entry = e;
+			thread_hits++;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * @brief stores the result of searching a position
+ * @param key zobrist key of the position
+ * @param depth depth the position was searched to
+ * @param bound what the score says about the true score
+ * @param score score of the search
+ * @param move best move found, may be empty
+ * 
+ * the entry of the same position is overwritten if there is one, otherwise the entry
+ * that is shallowest and from the oldest search is replaced
+ */
+void TranspositionTable::store(u64 key, int depth, Bound bound, float score, Move move)
+{
+	auto &entries   = bucket(key).entries;
+	TTSlot *replace = &entries[0];
+	TTEntry worst   = load(entries[0]);
+
+	auto age = [&](TTEntry const &e) { return (generation - e.generation()) & 0x3f; };
+
+	for (auto &slot : entries)
+	{
+		TTEntry e = load(slot);
+
+		if (e.key == key)
+		{
+			replace = &slot;
+
+			// keep the best move we know of if this search did not find one
+			if (move.is_empty())
+				move = e.move();
+
+			break;
+		}
+
+		if (e.depth() - 8 * age(e) < worst.depth() - 8 * age(worst))
+		{
+			replace = &slot;
+			worst   = e;
+		}
+	}
+
+	u64 data = 0;
+	data |= static_cast<u64>(std::bit_cast<u16>(move));
+	data |= static_cast<u64>(depth & 0xff) << 16;
+	data |= static_cast<u64>(bound) << 24;
+	data |= static_cast<u64>(generation) << 26;
+	data |= static_cast<u64>(std::bit_cast<u32>(score)) << 32;
+
+	replace->key.store(key ^ data, std::memory_order_relaxed);
+	replace->data.store(data, std::memory_order_relaxed);
+}
+
+/**
+ * @brief estimates how full the table is from a sample of its entries
+ * @return number of entries per thousand used by the current search
+ */
+int TranspositionTable::hashfull() const
+{
+	int used    = 0;
+	int sampled = 0;
+
+	for (std::size_t i = 0; i < count && sampled < 1000; i++)
+	{
+		for (auto const &slot : buckets[i].entries)
+		{
+			TTEntry e = load(slot);
+			if (e.bound() != BOUND_NONE && e.generation() == generation)
+				used++;
+			sampled++;
+		}
+	}
+
+	return used * 1000 / sampled;
+}
+
+/**
+ * @brief fraction of probes in the current search that found their position, counting the probes
+ * every search thread has added with add_thread_stats
+ */
+double TranspositionTable::hit_rate() const
+{
+	return probes == 0 ? 0.0 : static_cast<double>(hits) / probes;
+}
@@ -9,74 +9,311 @@
  */
 #include "uci.h"
 
-#include <cassert>
-#include <chrono>
+#include <algorithm>
+#include <charconv>
+#include <cmath>
 #include <iostream>
+#include <mutex>
 #include <sstream>
-#include <thread>
 #include <vector>
 
+#include "board.h"
+#include "game.h"
+#include "magic.h"
+#include "polyglot.h"
+#include "search.h"
+#include "tt.h"
+
+/**
+ * @brief parses a whole word as a number
+ * @param word the word to parse
+ * @param value set to the number, left as it was if the word is not a number or it does not fit
+ * @return true if the word was parsed
+ */
+template <typename T>
+static bool parse_number(std::string const &word, T &value)
+{
+	T parsed;
+	auto const *last = word.data() + word.size();
+	auto [end, ec]   = std::from_chars(word.data(), last, parsed);
+	if (ec != std::errc() || end != last)
+		return false;
+
+	value = parsed;
+	return true;
+}
+
+/**
+ * @brief runs the uci protocol on stdin and stdout until the gui quits or closes stdin
+ * searches run in the background so that stop and isready are answered while searching
+ */
 void uci()
 {
-	while (1)
+	std::string line;
+	while (std::getline(std::cin, line))
 	{
-		// get entire line of input
-		std::string line;
-		while (std::getline(std::cin, line))
+		// split line into words, ignoring extra whitespace
+		std::vector<std::string> words;
+		std::string word;
+		std::stringstream ss(line);
+		while (ss >> word)
+			words.push_back(word);
+
+		if (words.empty())
+			continue;
+
+		switch (decode_msg(words[0]))
 		{
-			// split line on space delimiter
-			std::vector<std::string> words;
-			std::string word = "";
-			std::stringstream ss(line);
-			while (std::getline(ss, word, ' '))
-				words.push_back(word);
-
-			switch (decode_msg(words[0]))
-			{
-				case UCI:
-					send_msg("id name excalibur 0.0.1");
-					send_msg("id author Sam Kravitz");
-					send_msg("uciok");
-					break;
-				case DEBUG:
-				case ISREADY:
-					send_msg("readyok");
-					break;
-				case UCINEWGAME:
-					// start a new game in the initial position
-					send_msg("readyok");
-					break;
-				case POSITION:
-					// position is starting from a fen
-					if (words[1] == "fen")
-					{
-						// loadfen(words[1])
-					}
-
-					// position is starting from start position
-					else if (words[1] == "startpos")
-					{
-					}
+			case UCI:
+				send_msg(std::string("id name excalibur 0.0.1 ") + Magic::backend_name());
+				send_msg("id author Sam Kravitz");
+				send_msg("option name Hash type spin default " + std::to_string(DEFAULT_HASH_MB) + " min 1 max 65536");
+				send_msg("option name Threads type spin default 1 min 1 max 512");
+				send_msg(std::string("option name BookFile type string default ") + DEFAULT_BOOK);
+				send_msg("uciok");
+				break;
+			case DEBUG:
+				break;
+			case ISREADY:
+				send_msg("readyok");
+				break;
+			case SETOPTION:
+				// the table can not be resized under a running search
+				searcher.stop();
+				searcher.wait();
 
+				// setoption name <id> value <x>
+				if (words.size() >= 5 && words[2] == "Hash")
+				{
+					std::size_t mb;
+					if (parse_number(words[4], mb))
+						tt.resize(std::clamp<std::size_t>(mb, 1, 65536));
 					else
-					{
-						std::cerr << line << "\n";
-						assert(!"Bad input to position uci command");
-					}
-					break;
-				case GO:
-					send_msg("info score cp -30");
-					break;
-				case STOP:
-					return;
-				case UNKNOWN:
-				default:
-					std::cerr << "Unrecognized message: " << line << "\n";
-			}
+						std::cerr << "Bad input to setoption uci command: " << line << "\n";
+				}
+
+				else if (words.size() >= 5 && words[2] == "Threads")
+				{
+					int threads;
+					if (parse_number(words[4], threads))
+						searcher.set_threads(std::clamp(threads, 1, 512));
+					else
+						std::cerr << "Bad input to setoption uci command: " << line << "\n";
+				}
+
+				// the path may contain spaces, an empty path turns the book off
+				else if (words.size() >= 4 && words[2] == "BookFile")
+				{
+					std::string path;
+					for (std::size_t i = 4; i < words.size(); i++)
+						path += (i > 4 ? " " : "") + words[i];
+
+					if (path.empty() || path == "<empty>")
+						book.close();
+					else
+						book.open(path);
+				}
+				break;
+			case UCINEWGAME:
+				// results from the last game are no use in the next
+				searcher.stop();
+				searcher.wait();
+				tt.clear();
+				board.reset();
+				break;
+			case POSITION:
+				searcher.stop();
+				searcher.wait();
+				uci_position(words);
+				break;
+			case GO:
+				// a new search replaces the one running, start() would otherwise block until it finished
+				searcher.stop();
+				searcher.wait();
+				uci_go(words);
+				break;
+			case STOP:
+				searcher.stop();
+				break;
+			case QUIT:
+				searcher.stop();
+				searcher.wait();
+				return;
+			case UNKNOWN:
+			default:
+				std::cerr << "Unrecognized message: " << line << "\n";
+		}
+	}
+
+	searcher.stop();
+	searcher.wait();
+}
+
+/**
+ * @brief sets up the board from a position command
+ * @param words position [fen <fen> | startpos] moves <move1> ... <movei>
+ */
+void uci_position(std::vector<std::string> const &words)
+{
+	std::size_t i = 2;
+
+	if (words.size() >= 2 && words[1] == "startpos")
+		board.reset();
+
+	else if (words.size() >= 2 && words[1] == "fen")
+	{
+		std::string fen;
+		for (; i < words.size() && words[i] != "moves"; i++)
+			fen += words[i] + " ";
+
+		// an invalid fen leaves the last position on the board
+		if (!load_fen(fen))
+			return;
+	}
+
+	else
+	{
+		std::cerr << "Bad input to position uci command\n";
+		return;
+	}
+
+	// the moves are played up to the first illegal one
+	if (i < words.size() && words[i] == "moves")
+		for (i++; i < words.size(); i++)
+			if (!parse_uci_move(words[i]))
+				break;
+}
+
+/**
+ * @brief starts searching the current position in the background
+ * @param words go [wtime <x>] [btime <x>] [winc <x>] [binc <x>] [movestogo <x>] [depth <x>]
+ * [nodes <x>] [movetime <x>] [infinite]
+ */
+void uci_go(std::vector<std::string> const &words)
+{
+	SearchLimits limits;
+	int time[2]   = { 0, 0 };
+	int inc[2]    = { 0, 0 };
+	int movestogo = 0;
+
+	for (std::size_t i = 1; i < words.size(); i++)
+	{
+		auto const &w = words[i];
+
+		// reads the value following w, a missing or bad value is skipped over along with w
+		auto value = [&](auto &x)
+		{
+			if (i + 1 < words.size() && parse_number(words[i + 1], x))
+				i++;
+			else
+				std::cerr << "Bad input to go uci command: " << w << "\n";
+		};
+
+		if (w == "infinite")
+			limits.infinite = true;
+		else if (w == "wtime")
+			value(time[WHITE]);
+		else if (w == "btime")
+			value(time[BLACK]);
+		else if (w == "winc")
+			value(inc[WHITE]);
+		else if (w == "binc")
+			value(inc[BLACK]);
+		else if (w == "movestogo")
+			value(movestogo);
+		else if (w == "depth")
+			value(limits.depth);
+		else if (w == "nodes")
+			value(limits.nodes);
+		else if (w == "movetime")
+			value(limits.movetime);
+	}
+
+	// play from the book straight away, unless the gui wants to analyze the position
+	if (!limits.infinite)
+	{
+		auto book_move = polyglot();
+		if (!book_move.is_empty())
+		{
+			std::stringstream msg;
+			msg << "bestmove " << book_move;
+			send_msg(msg.str());
+			return;
 		}
+	}
+
+	Color us = board.mover();
+	if (!limits.infinite && !limits.movetime && time[us] > 0)
+		limits.movetime = time_budget(time[us], inc[us], movestogo);
+
+	auto send_info = [](SearchInfo const &info)
+	{
+		auto ms = std::max<u64>(info.time.count(), 1);
+
+		std::stringstream msg;
+		msg << "info depth " << info.depth << " score " << uci_score(info.score) << " nodes " << info.nodes
+		    << " nps " << info.nodes * 1000 / ms << " time " << info.time.count()
+		    << " hashfull " << tt.hashfull() << " pv";
+		for (auto mv : info.pv)
+			msg << " " << mv;
 
-		std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+		send_msg(msg.str());
+
+		// uci has no field for it, but the hit rate is what the hash size is chosen by
+		send_msg("info string hash hit rate " + std::to_string(tt.hit_rate()));
+	};
+
+	// with no legal move the score tells the gui whether it is checkmate or stalemate
+	auto send_bestmove = [](Move move, float score)
+	{
+		if (move.is_empty())
+		{
+			send_msg("info depth 0 score " + uci_score(score));
+			send_msg("bestmove 0000");
+			return;
+		}
+
+		std::stringstream msg;
+		msg << "bestmove " << move;
+		send_msg(msg.str());
+	};
+
+	searcher.start(board, limits, send_info, send_bestmove);
+}
+
+/**
+ * @brief decides how long to search a move for
+ * @param time time left on our clock in milliseconds
+ * @param inc our increment per move in milliseconds
+ * @param movestogo moves until the next time control, 0 if the rest of the game must be played in time
+ * @return milliseconds to search for
+ */
+int time_budget(int time, int inc, int movestogo)
+{
+	// an even share of the time left over the moves still to play, assuming 30 in sudden death,
+	// plus most of the increment, leaving a margin for the gui's overhead
+	int moves  = movestogo > 0 ? movestogo : 30;
+	int budget = time / moves + inc * 3 / 4;
+
+	return std::clamp(budget, 1, std::max(time - 50, 1));
+}
+
+/**
+ * @brief formats a search score for an info message
+ * @param score score in pawns relative to the side to move, see MATE for mate scores
+ * @return "mate <moves>", negative if we are getting mated, or "cp <centipawns>"
+ */
+std::string uci_score(float score)
+{
+	score = std::clamp(score, -MATE, MATE);
+
+	if (std::abs(score) >= MATE_BOUND)
+	{
+		long ply = std::lround(MATE - std::abs(score));
+		return "mate " + std::to_string(score > 0 ? (ply + 1) / 2 : -ply / 2);
 	}
+
+	return "cp " + std::to_string(std::lround(score * 100));
 }
 
 UciType decode_msg(std::string const &msg)
@@ -87,6 +324,8 @@ UciType decode_msg(std::string const &msg)
 		return DEBUG;
 	else if (msg == "isready")
 		return ISREADY;
+	else if (msg == "setoption")
+		return SETOPTION;
 	else if (msg == "ucinewgame")
 		return UCINEWGAME;
 	else if (msg == "position")
@@ -95,11 +334,21 @@ UciType decode_msg(std::string const &msg)
 		return GO;
 	else if (msg == "stop")
 		return STOP;
+	else if (msg == "quit")
+		return QUIT;
 	else
 		return UNKNOWN;
 }
 
+/**
+ * @brief writes a message to the gui
+ * messages are sent from both the uci thread and the search thread, and must reach the gui
+ * straight away rather than sitting in a buffer
+ */
 void send_msg(std::string const &msg)
 {
-	std::cout << msg << "\n";
+	static std::mutex mutex;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	std::cout << msg << std::endl;
 }